@@ -24,9 +24,170 @@
 
 #endif
 
-STATIC const Dio_ConfigChannel * Dio_PortChannels = NULL_PTR;
+#if (DIO_TRACE_API == STD_ON)
+/* DWT cycle counter used to timestamp the trace records */
+#include "Profiling.h"
+
+#if ((DIO_TRACE_RING_SIZE & (DIO_TRACE_RING_SIZE - 1U)) != 0U)
+  #error "DIO_TRACE_RING_SIZE shall be a power of two"
+#endif
+
+/* Trace ring, the oldest record is overwritten when it is full */
+STATIC Dio_TraceRecordType Dio_TraceRing[DIO_TRACE_RING_SIZE];
+
+/* Number of records taken since Dio_Init, the next record goes to slot Dio_TraceCount % DIO_TRACE_RING_SIZE */
+STATIC uint32 Dio_TraceCount = 0U;
+
+/*
+ * Take a trace record. It costs a load of CYCCNT, a load/increment/store of Dio_TraceCount and
+ * four stores, about 10 to 12 cycles on the Cortex-M4 (estimate from the instruction count,
+ * not a measurement). A record taken by an ISR preempting another one may share its slot.
+ */
+#define DIO_TRACE(SID,ID,VALUE) \
+	do \
+	{ \
+		Dio_TraceRecordType * Record = &Dio_TraceRing[Dio_TraceCount++ & (DIO_TRACE_RING_SIZE - 1U)]; \
+		Record->Cycles = MMIO_READ32(DWT_CYCCNT_ADDRESS); \
+		Record->Sid    = (SID); \
+		Record->Id     = (uint8)(ID); \
+		Record->Value  = (uint8)(VALUE); \
+	} while (0)
+#else
+/* Trace points compile to nothing */
+#define DIO_TRACE(SID,ID,VALUE)
+#endif
+
+#if (DIO_PROFILING_API == STD_ON)
+/* Cycle count statistics of the Dio services indexed by their service ID */
+STATIC Profiling_StatType Dio_Profile[DIO_PROFILING_SIDS];
+
+/* Bracket a service, the END point shall be reached on every return path */
+#define DIO_PROFILE_BEGIN()     uint32 Dio_ProfileStart = PROFILING_GET_CYCLES()
+#define DIO_PROFILE_END(SID)    Profiling_Record(&Dio_Profile[(SID)], PROFILING_GET_CYCLES() - Dio_ProfileStart)
+#else
+/* Profiling points compile to nothing */
+#define DIO_PROFILE_BEGIN()
+#define DIO_PROFILE_END(SID)
+#endif
+
 STATIC uint8 Dio_Status = DIO_NOT_INITIALIZED;
 
+/* GPIO ports base addresses indexed by the Port_Num member of Dio_ConfigChannel */
+STATIC const uint32 Dio_PortBaseAddress[DIO_NUMBER_OF_PORTS] =
+{
+	DIO_GPIO_PORT_BASE_ADDRESS(0U),
+	DIO_GPIO_PORT_BASE_ADDRESS(1U),
+	DIO_GPIO_PORT_BASE_ADDRESS(2U),
+	DIO_GPIO_PORT_BASE_ADDRESS(3U),
+	DIO_GPIO_PORT_BASE_ADDRESS(4U),
+	DIO_GPIO_PORT_BASE_ADDRESS(5U)
+};
+
+/* Runtime channels table filled by Dio_Init, indexed by the channel ID */
+STATIC Dio_ChannelRuntimeType Dio_Channels[DIO_CONFIGURED_CHANNLES];
+
+/* Base addresses of the configured ports filled by Dio_Init, indexed by the port ID */
+STATIC uint32 Dio_PortsBase[DIO_CONFIGURED_PORTS];
+
+/* Configured channel groups, used to map a Dio_ChannelGroupType pointer to its runtime entry */
+STATIC const Dio_ChannelGroupType * Dio_GroupsConfig = NULL_PTR;
+
+/* Runtime channel groups table filled by Dio_Init, in the same order as the configured groups */
+STATIC Dio_ChannelGroupRuntimeType Dio_Groups[DIO_CONFIGURED_CHANNEL_GROUPS];
+
+/* Bit of every hardware port used by the configured channels and ports (bit n for port n),
+ * the services reading several ports only access these ones as the others may not be clocked */
+STATIC uint8 Dio_ActivePorts = 0U;
+
+#if (DIO_READ_CACHE == STD_ON)
+/* Snapshot Dio_ReadChannel is served from, taken by Dio_RefreshReadCache */
+STATIC Dio_PortsSnapshotType Dio_ReadCache;
+#endif
+
+/* Read the DATA register of every active port, the other ports read as zeros */
+STATIC void Dio_SnapshotPorts(Dio_PortsSnapshotType * Snapshot)
+{
+	uint8 PortNum;
+
+	for (PortNum = 0U; PortNum < DIO_NUMBER_OF_PORTS; PortNum++)
+	{
+		if (BIT_IS_SET(Dio_ActivePorts, PortNum))
+		{
+			Snapshot->Levels[PortNum] = (Dio_PortLevelType)MMIO_READ32(DIO_GPIO_DATA_MASKED_ADDRESS(Dio_PortBaseAddress[PortNum], DIO_GPIO_ALL_PINS_MASK));
+		}
+		else
+		{
+			Snapshot->Levels[PortNum] = 0U;
+		}
+	}
+}
+
+#if (DIO_STAGED_UPDATE_API == STD_ON)
+/* TRUE between Dio_BeginUpdate and Dio_Commit */
+STATIC boolean Dio_UpdateActive = FALSE;
+
+/* Shadow image of the staged levels and mask of the staged (dirty) channels of each port */
+STATIC uint8 Dio_ShadowLevel[DIO_NUMBER_OF_PORTS];
+STATIC uint8 Dio_ShadowDirty[DIO_NUMBER_OF_PORTS];
+
+/* Stage the level of a channel in the shadow image of its port, Dio_Commit writes it to the hardware */
+STATIC void Dio_ShadowChannel(const Dio_ChannelRuntimeType * Channel, Dio_LevelType Level)
+{
+	if(Level == STD_HIGH)
+	{
+		Dio_ShadowLevel[Channel->Port_Num] |= Channel->Pin_Mask;
+		Dio_ShadowDirty[Channel->Port_Num] |= Channel->Pin_Mask;
+	}
+	else if(Level == STD_LOW)
+	{
+		Dio_ShadowLevel[Channel->Port_Num] &= (uint8)(~Channel->Pin_Mask);
+		Dio_ShadowDirty[Channel->Port_Num] |= Channel->Pin_Mask;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+/* Stage the flipped level of a channel and return it */
+STATIC Dio_LevelType Dio_ShadowFlipChannel(const Dio_ChannelRuntimeType * Channel)
+{
+	Dio_LevelType output;
+
+	if (Dio_ShadowDirty[Channel->Port_Num] & Channel->Pin_Mask)
+	{
+		/* Already staged in this transaction, flip the staged level */
+		output = (Dio_ShadowLevel[Channel->Port_Num] & Channel->Pin_Mask) ? STD_LOW : STD_HIGH;
+	}
+	else
+	{
+		/* Not staged yet, flip the hardware level so writes done outside the transaction are honoured */
+		output = (MMIO_READ32(Channel->Data_Address) & Channel->Mask) ? STD_LOW : STD_HIGH;
+	}
+	Dio_ShadowChannel(Channel, output);
+	return output;
+}
+#endif
+#endif
+
+#if (DIO_DEBOUNCE_API == STD_ON)
+/* TRUE once the debounced state has been seeded with a first sample */
+STATIC boolean Dio_DebounceSeeded = FALSE;
+
+/* Debounced levels, the two bit-planes of the vertical counters and the latched edges */
+STATIC uint32 Dio_DebounceState[DIO_DEBOUNCE_WORDS];
+STATIC uint32 Dio_DebounceCount0[DIO_DEBOUNCE_WORDS];
+STATIC uint32 Dio_DebounceCount1[DIO_DEBOUNCE_WORDS];
+STATIC uint32 Dio_DebounceRising[DIO_DEBOUNCE_WORDS];
+STATIC uint32 Dio_DebounceFalling[DIO_DEBOUNCE_WORDS];
+
+/* Word and bit of a channel in the debounce bitmaps */
+#define DIO_DEBOUNCE_WORD(CHANNEL) ((CHANNEL)->Port_Num / DIO_DEBOUNCE_PORTS_PER_WORD)
+#define DIO_DEBOUNCE_BIT(CHANNEL)  ((uint32)(CHANNEL)->Pin_Mask << \
+                                    (((CHANNEL)->Port_Num % DIO_DEBOUNCE_PORTS_PER_WORD) * DIO_NUMBER_OF_PORT_CHANNELS))
+#endif
+
 /************************************************************************************
 * Service Name: Dio_Init
 * Service ID[hex]: 0x10
@@ -40,23 +201,181 @@ STATIC uint8 Dio_Status = DIO_NOT_INITIALIZED;
 ************************************************************************************/
 void Dio_Init(const Dio_ConfigType * ConfigPtr)
 {
+	boolean error = FALSE;
+	uint8 Index;
+	DIO_PROFILE_BEGIN();
+
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 	/* check if the input configuration pointer is not a NULL_PTR */
 	if (NULL_PTR == ConfigPtr)
 	{
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_INIT_SID,
 		     DIO_E_PARAM_CONFIG);
+		error = TRUE;
 	}
 	else
 #endif
+	{
+		/* Reject the whole configuration if any channel refers to a port or a pin that does not exist */
+		for (Index = 0U; Index < DIO_CONFIGURED_CHANNLES; Index++)
+		{
+			if ((ConfigPtr->Channels[Index].Port_Num >= DIO_NUMBER_OF_PORTS)
+			 || (ConfigPtr->Channels[Index].Ch_Num >= DIO_NUMBER_OF_PORT_CHANNELS))
+			{
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+				Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_INIT_SID,
+				     DIO_E_PARAM_CONFIG);
+#endif
+				error = TRUE;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+		for (Index = 0U; Index < DIO_CONFIGURED_PORTS; Index++)
+		{
+			if (ConfigPtr->Ports[Index].Port_Num >= DIO_NUMBER_OF_PORTS)
+			{
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+				Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_INIT_SID,
+				     DIO_E_PARAM_CONFIG);
+#endif
+				error = TRUE;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+		for (Index = 0U; Index < DIO_CONFIGURED_CHANNEL_GROUPS; Index++)
+		{
+			/* The group must belong to a configured port and its mask must start at its offset */
+			if ((ConfigPtr->Groups[Index].PortIndex >= DIO_CONFIGURED_PORTS)
+			 || (ConfigPtr->Groups[Index].offset >= DIO_NUMBER_OF_PORT_CHANNELS)
+			 || (0U == ConfigPtr->Groups[Index].mask)
+			 || (BIT_IS_CLEAR(ConfigPtr->Groups[Index].mask, ConfigPtr->Groups[Index].offset))
+			 || (0U != (ConfigPtr->Groups[Index].mask & ((1U << ConfigPtr->Groups[Index].offset) - 1U))))
+			{
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+				Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_INIT_SID,
+				     DIO_E_PARAM_CONFIG);
+#endif
+				error = TRUE;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+	}
+
+	/* In-case there are no errors */
+	if (FALSE == error)
 	{
 		/*
-		 * Set the module state to initialized and point to the PB configuration structure using a global pointer.
-		 * This global pointer is global to be used by other functions to read the PB configuration structures
+		 * Resolve each configured channel to its GPIO DATA register and bit mask once,
+		 * so the channel services become one table load plus the register access.
 		 */
-		Dio_Status       = DIO_INITIALIZED;
-		Dio_PortChannels = ConfigPtr->Channels; /* address of the first Channels structure --> Channels[0] */
+		for (Index = 0U; Index < DIO_CONFIGURED_CHANNLES; Index++)
+		{
+			uint32 Mask = ((uint32)1U << ConfigPtr->Channels[Index].Ch_Num);
+			uint32 Base = Dio_PortBaseAddress[ConfigPtr->Channels[Index].Port_Num];
+
+#if (DIO_CHANNEL_ACCESS_MODE == DIO_CHANNEL_ACCESS_BITBAND)
+			/* Bit-band alias word of this channel bit in GPIODATA, it reads as 0/1 so the mask becomes bit 0 */
+			Dio_Channels[Index].Data_Address = DIO_BITBAND_ALIAS_ADDRESS(
+			                                   Base + DIO_GPIO_DATA_MASKED_OFFSET(DIO_GPIO_ALL_PINS_MASK),
+			                                   ConfigPtr->Channels[Index].Ch_Num);
+			Mask = (uint32)STD_HIGH;
+#elif (DIO_CHANNEL_ACCESS_MODE == DIO_CHANNEL_ACCESS_MASKED)
+			/* Masked alias of this channel bit, accesses through it can not touch the other port bits */
+			Dio_Channels[Index].Data_Address = DIO_GPIO_DATA_MASKED_ADDRESS(Base, Mask);
+#else
+			/* Full GPIODATA register of the port */
+			Dio_Channels[Index].Data_Address = DIO_GPIO_DATA_MASKED_ADDRESS(Base, DIO_GPIO_ALL_PINS_MASK);
+#endif
+			Dio_Channels[Index].Mask     = Mask;
+			Dio_Channels[Index].Port_Num = ConfigPtr->Channels[Index].Port_Num;
+			Dio_Channels[Index].Pin_Mask = (uint8)(1U << ConfigPtr->Channels[Index].Ch_Num);
+		}
+		for (Index = 0U; Index < DIO_CONFIGURED_PORTS; Index++)
+		{
+			Dio_PortsBase[Index] = Dio_PortBaseAddress[ConfigPtr->Ports[Index].Port_Num];
+		}
+		/* Each group is written through the masked alias of its own bits, so a group write can not glitch other pins */
+		for (Index = 0U; Index < DIO_CONFIGURED_CHANNEL_GROUPS; Index++)
+		{
+			Dio_Groups[Index].Data_Address = DIO_GPIO_DATA_MASKED_ADDRESS(Dio_PortsBase[ConfigPtr->Groups[Index].PortIndex],
+			                                                        ConfigPtr->Groups[Index].mask);
+			Dio_Groups[Index].Offset   = ConfigPtr->Groups[Index].offset;
+		}
+		Dio_GroupsConfig = ConfigPtr->Groups;
+
+		Dio_ActivePorts = 0U;
+		for (Index = 0U; Index < DIO_CONFIGURED_CHANNLES; Index++)
+		{
+			Dio_ActivePorts |= (uint8)(1U << ConfigPtr->Channels[Index].Port_Num);
+		}
+		for (Index = 0U; Index < DIO_CONFIGURED_PORTS; Index++)
+		{
+			Dio_ActivePorts |= (uint8)(1U << ConfigPtr->Ports[Index].Port_Num);
+		}
+
+#if (DIO_STAGED_UPDATE_API == STD_ON)
+		/* Drop any transaction left open and the channels it staged */
+		Dio_UpdateActive = FALSE;
+		for (Index = 0U; Index < DIO_NUMBER_OF_PORTS; Index++)
+		{
+			Dio_ShadowLevel[Index] = 0U;
+			Dio_ShadowDirty[Index] = 0U;
+		}
+#endif
+
+#if (DIO_DEBOUNCE_API == STD_ON)
+		Dio_DebounceSeeded = FALSE;
+#endif
+
+#if (DIO_TRACE_API == STD_ON)
+		/* Start the cycle counter used by the trace records */
+		PROFILING_START_CYCLE_COUNTER();
+		Dio_TraceCount  = 0U;
+#endif
+
+		/* Set the module state to initialized */
+		Dio_Status = DIO_INITIALIZED;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	DIO_PROFILE_END(DIO_INIT_SID);
+}
+
+/************************************************************************************
+* Service Name: Dio_GetPortBaseAddress
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Base address of the port resolved by Dio_Init, 0 if not available.
+* Description: Function to give the Dio sub-modules the port table filled by Dio_Init, it returns
+*              0 before Dio_Init and for an invalid PortId so the caller can report the error.
+************************************************************************************/
+uint32 Dio_GetPortBaseAddress(Dio_PortType PortId)
+{
+	uint32 Base = 0U;
+
+	if ((DIO_INITIALIZED == Dio_Status) && (DIO_CONFIGURED_PORTS > PortId))
+	{
+		Base = Dio_PortsBase[PortId];
+	}
+	else
+	{
+		/* No Action Required */
 	}
+	return Base;
 }
 
 /************************************************************************************
@@ -73,8 +392,8 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr)
 ************************************************************************************/
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
 	boolean error = FALSE;
+	DIO_PROFILE_BEGIN();
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 	/* Check if the Driver is initialized before using this function */
@@ -105,38 +424,44 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-                    case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-                    case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-                    case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
+		/* Runtime entry holding the DATA register address and the mask of this channel */
+		const Dio_ChannelRuntimeType * Channel = &Dio_Channels[ChannelId];
+
+#if (DIO_CHANNEL_ACCESS_MODE != DIO_CHANNEL_ACCESS_RMW)
+		/* The masked/bit-band alias ignores every bit outside the channel mask, so one store writes the level */
+		if(Level == STD_HIGH)
+		{
+			/* Write Logic High */
+			MMIO_WRITE32(Channel->Data_Address, Channel->Mask);
+			DIO_TRACE(DIO_WRITE_CHANNEL_SID, ChannelId, Level);
+		}
+		else if(Level == STD_LOW)
+		{
+			/* Write Logic Low */
+			MMIO_WRITE32(Channel->Data_Address, 0U);
+			DIO_TRACE(DIO_WRITE_CHANNEL_SID, ChannelId, Level);
 		}
+#else
 		if(Level == STD_HIGH)
 		{
 			/* Write Logic High */
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			MMIO_SET_BITS32(Channel->Data_Address, Channel->Mask);
+			DIO_TRACE(DIO_WRITE_CHANNEL_SID, ChannelId, Level);
 		}
 		else if(Level == STD_LOW)
 		{
 			/* Write Logic Low */
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			MMIO_CLEAR_BITS32(Channel->Data_Address, Channel->Mask);
+			DIO_TRACE(DIO_WRITE_CHANNEL_SID, ChannelId, Level);
 		}
+#endif
 	}
 	else
 	{
 		/* No Action Required */
 	}
 
+	DIO_PROFILE_END(DIO_WRITE_CHANNEL_SID);
 }
 
 /************************************************************************************
@@ -152,9 +477,9 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 ************************************************************************************/
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
 	Dio_LevelType output = STD_LOW;
 	boolean error = FALSE;
+	DIO_PROFILE_BEGIN();
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 	/* Check if the Driver is initialized before using this function */
@@ -185,24 +510,16 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-                    case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-                    case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-                    case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
+		/* Runtime entry holding the DATA register address and the mask of this channel */
+		const Dio_ChannelRuntimeType * Channel = &Dio_Channels[ChannelId];
+
+#if (DIO_READ_CACHE == STD_ON)
+		/* Served from the last snapshot, every read of the same tick is consistent */
+		if(Dio_ReadCache.Levels[Channel->Port_Num] & Channel->Pin_Mask)
+#else
 		/* Read the required channel */
-		if(BIT_IS_SET(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num))
+		if(MMIO_READ32(Channel->Data_Address) & Channel->Mask)
+#endif
 		{
 			output = STD_HIGH;
 		}
@@ -215,127 +532,1224 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 	{
 		/* No Action Required */
 	}
+	DIO_PROFILE_END(DIO_READ_CHANNEL_SID);
         return output;
 }
 
 /************************************************************************************
-* Service Name: Dio_GetVersionInfo
-* Service ID[hex]: 0x12
+* Service Name: Dio_WriteChannels
+* Service ID[hex]: 0x20
 * Sync/Async: Synchronous
 * Reentrancy: Reentrant
-* Parameters (in): None
+* Parameters (in): ChannelIds - Array of DIO channels IDs.
+*                  Levels - Array of the values to be written, Levels[i] is written to ChannelIds[i].
+*                  NumberOfChannels - Number of elements in ChannelIds and Levels.
 * Parameters (inout): None
-* Parameters (out): VersionInfo - Pointer to where to store the version information of this module.
+* Parameters (out): None
 * Return value: None
-* Description: Function to get the version information of this module.
+* Description: Function to set the levels of several channels, the channels are grouped per port
+*              and each port is updated with at most one store.
 ************************************************************************************/
-#if (DIO_VERSION_INFO_API == STD_ON)
-void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo)
+#if (DIO_MULTI_CHANNEL_API == STD_ON)
+void Dio_WriteChannels(const Dio_ChannelType * ChannelIds, const Dio_LevelType * Levels, uint8 NumberOfChannels)
 {
+	boolean error = FALSE;
+	uint8 Index;
+	DIO_PROFILE_BEGIN();
+
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
-	/* Check if input pointer is not Null pointer */
-	if(NULL_PTR == versioninfo)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
 	{
-		/* Report to DET  */
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
-				DIO_GET_VERSION_INFO_SID, DIO_E_PARAM_POINTER);
+				DIO_WRITE_CHANNELS_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if input pointers are not Null pointers */
+	else if ((NULL_PTR == ChannelIds) || (NULL_PTR == Levels))
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNELS_SID, DIO_E_PARAM_POINTER);
+		error = TRUE;
 	}
 	else
-#endif /* (DIO_DEV_ERROR_DETECT == STD_ON) */
 	{
-		/* Copy the vendor Id */
-		versioninfo->vendorID = (uint16)DIO_VENDOR_ID;
-		/* Copy the module Id */
-		versioninfo->moduleID = (uint16)DIO_MODULE_ID;
-		/* Copy Software Major Version */
-		versioninfo->sw_major_version = (uint8)DIO_SW_MAJOR_VERSION;
-		/* Copy Software Minor Version */
-		versioninfo->sw_minor_version = (uint8)DIO_SW_MINOR_VERSION;
-		/* Copy Software Patch Version */
-		versioninfo->sw_patch_version = (uint8)DIO_SW_PATCH_VERSION;
+		/* Check if all the used channels are within the valid range */
+		for (Index = 0U; Index < NumberOfChannels; Index++)
+		{
+			if (DIO_CONFIGURED_CHANNLES <= ChannelIds[Index])
+			{
+				Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+						DIO_WRITE_CHANNELS_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+				error = TRUE;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
 	}
-}
 #endif
 
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		uint8 PortNum;
+		/* Bits to be changed and their new values in each port */
+		uint8 ChangeMask[DIO_NUMBER_OF_PORTS] = {0U};
+		uint8 SetMask[DIO_NUMBER_OF_PORTS] = {0U};
+
+		/* Coalesce the requested levels per port, the last level of a repeated channel wins */
+		for (Index = 0U; Index < NumberOfChannels; Index++)
+		{
+			const Dio_ChannelRuntimeType * Channel = &Dio_Channels[ChannelIds[Index]];
+
+			if(Levels[Index] == STD_HIGH)
+			{
+				ChangeMask[Channel->Port_Num] |= Channel->Pin_Mask;
+				SetMask[Channel->Port_Num]    |= Channel->Pin_Mask;
+			}
+			else if(Levels[Index] == STD_LOW)
+			{
+				ChangeMask[Channel->Port_Num] |= Channel->Pin_Mask;
+				SetMask[Channel->Port_Num]    &= (uint8)(~Channel->Pin_Mask);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+
+		/* Commit each touched port with one store through the masked alias of its changed bits */
+		for (PortNum = 0U; PortNum < DIO_NUMBER_OF_PORTS; PortNum++)
+		{
+			if (0U != ChangeMask[PortNum])
+			{
+				MMIO_WRITE32(DIO_GPIO_DATA_MASKED_ADDRESS(Dio_PortBaseAddress[PortNum], ChangeMask[PortNum]), SetMask[PortNum]);
+				DIO_TRACE(DIO_WRITE_CHANNELS_SID, PortNum, SetMask[PortNum]);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	DIO_PROFILE_END(DIO_WRITE_CHANNELS_SID);
+}
+
 /************************************************************************************
-* Service Name: Dio_FlipChannel
-* Service ID[hex]: 0x11
+* Service Name: Dio_ReadChannels
+* Service ID[hex]: 0x21
 * Sync/Async: Synchronous
 * Reentrancy: Reentrant
-* Parameters (in): ChannelId - ID of DIO channel.
+* Parameters (in): ChannelIds - Array of DIO channels IDs.
+*                  NumberOfChannels - Number of elements in ChannelIds (maximum DIO_MAX_READ_CHANNELS).
 * Parameters (inout): None
 * Parameters (out): None
-* Return value: Dio_LevelType
-* Description: Function to flip the level of a channel and return the level of the channel after flip.
+* Return value: uint32 - Levels bitmap, bit i holds the level of ChannelIds[i].
+* Description: Function to return the levels of several channels, each involved port is read once.
+*              Without development error detection only the first DIO_MAX_READ_CHANNELS
+*              channels are read.
 ************************************************************************************/
-#if (DIO_FLIP_CHANNEL_API == STD_ON)
-Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
+uint32 Dio_ReadChannels(const Dio_ChannelType * ChannelIds, uint8 NumberOfChannels)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
-	Dio_LevelType output = STD_LOW;
+	uint32 output = 0U;
 	boolean error = FALSE;
+	uint8 Index;
+	/* Channels read, never more than the bits of the result bitmap */
+	uint8 Count = (DIO_MAX_READ_CHANNELS < NumberOfChannels) ? (uint8)DIO_MAX_READ_CHANNELS : NumberOfChannels;
+	DIO_PROFILE_BEGIN();
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 	/* Check if the Driver is initialized before using this function */
 	if (DIO_NOT_INITIALIZED == Dio_Status)
 	{
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
-				DIO_FLIP_CHANNEL_SID, DIO_E_UNINIT);
+				DIO_READ_CHANNELS_SID, DIO_E_UNINIT);
 		error = TRUE;
 	}
-	else
+	/* Check if input pointer is not Null pointer */
+	else if (NULL_PTR == ChannelIds)
 	{
-		/* No Action Required */
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNELS_SID, DIO_E_PARAM_POINTER);
+		error = TRUE;
 	}
-	/* Check if the used channel is within the valid range */
-	if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+	/* Check if the result bitmap can hold all the requested channels */
+	else if (DIO_MAX_READ_CHANNELS < NumberOfChannels)
 	{
-
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
-				DIO_FLIP_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+				DIO_READ_CHANNELS_SID, DIO_E_PARAM_LENGTH);
 		error = TRUE;
 	}
 	else
 	{
-		/* No Action Required */
+		/* Check if all the used channels are within the valid range */
+		for (Index = 0U; Index < NumberOfChannels; Index++)
+		{
+			if (DIO_CONFIGURED_CHANNLES <= ChannelIds[Index])
+			{
+				Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+						DIO_READ_CHANNELS_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+				error = TRUE;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
 	}
 #endif
 
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-                    case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-                    case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-                    case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
+		uint8 PortNum;
+		/* Bits needed from each port and the levels read from it */
+		uint8 ReadMask[DIO_NUMBER_OF_PORTS] = {0U};
+		uint8 PortLevel[DIO_NUMBER_OF_PORTS];
+
+		for (Index = 0U; Index < Count; Index++)
+		{
+			ReadMask[Dio_Channels[ChannelIds[Index]].Port_Num] |= Dio_Channels[ChannelIds[Index]].Pin_Mask;
 		}
-		/* Read the required channel and write the required level */
-		if(BIT_IS_SET(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num))
+
+		/* Read each involved port once */
+		for (PortNum = 0U; PortNum < DIO_NUMBER_OF_PORTS; PortNum++)
 		{
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
-			output = STD_LOW;
+			if (0U != ReadMask[PortNum])
+			{
+				PortLevel[PortNum] = (uint8)MMIO_READ32(DIO_GPIO_DATA_MASKED_ADDRESS(Dio_PortBaseAddress[PortNum], ReadMask[PortNum]));
+			}
+			else
+			{
+				PortLevel[PortNum] = 0U;
+			}
 		}
-		else
+
+		/* Build the levels bitmap in the order of the requested channels */
+		for (Index = 0U; Index < Count; Index++)
 		{
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			const Dio_ChannelRuntimeType * Channel = &Dio_Channels[ChannelIds[Index]];
+
+			if (PortLevel[Channel->Port_Num] & Channel->Pin_Mask)
+			{
+				output |= ((uint32)1U << Index);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	DIO_PROFILE_END(DIO_READ_CHANNELS_SID);
+        return output;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_BeginUpdate
+* Service ID[hex]: 0x22
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start an update transaction. Until Dio_Commit is called,
+*              Dio_StageChannel and Dio_StageFlipChannel only modify a RAM shadow image of
+*              the outputs. Dio_WriteChannel and Dio_FlipChannel keep writing the hardware,
+*              so an ISR using them is not affected by a transaction of the application.
+*              Transactions do not nest, one task owns the transaction until Dio_Commit.
+************************************************************************************/
+#if (DIO_STAGED_UPDATE_API == STD_ON)
+void Dio_BeginUpdate(void)
+{
+	DIO_PROFILE_BEGIN();
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_BEGIN_UPDATE_SID, DIO_E_UNINIT);
+	}
+	/* Check if a transaction is not already open */
+	else if (TRUE == Dio_UpdateActive)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_BEGIN_UPDATE_SID, DIO_E_TRANSACTION);
+	}
+	else
+#endif
+	{
+		Dio_UpdateActive = TRUE;
+	}
+	DIO_PROFILE_END(DIO_BEGIN_UPDATE_SID);
+}
+
+/************************************************************************************
+* Service Name: Dio_Commit
+* Service ID[hex]: 0x23
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to end an update transaction, every port with staged channels is
+*              written with one store to the masked alias of its staged channels, so the
+*              channels not staged keep any value written to them directly.
+************************************************************************************/
+void Dio_Commit(void)
+{
+	uint8 PortNum;
+	DIO_PROFILE_BEGIN();
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_COMMIT_SID, DIO_E_UNINIT);
+	}
+	/* Check if a transaction is open */
+	else if (FALSE == Dio_UpdateActive)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_COMMIT_SID, DIO_E_TRANSACTION);
+	}
+	else
+#endif
+	{
+		for (PortNum = 0U; PortNum < DIO_NUMBER_OF_PORTS; PortNum++)
+		{
+			if (0U != Dio_ShadowDirty[PortNum])
+			{
+				MMIO_WRITE32(DIO_GPIO_DATA_MASKED_ADDRESS(Dio_PortBaseAddress[PortNum], Dio_ShadowDirty[PortNum]), Dio_ShadowLevel[PortNum]);
+				DIO_TRACE(DIO_COMMIT_SID, PortNum, Dio_ShadowLevel[PortNum]);
+				Dio_ShadowDirty[PortNum] = 0U;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+		Dio_UpdateActive = FALSE;
+	}
+	DIO_PROFILE_END(DIO_COMMIT_SID);
+}
+
+/************************************************************************************
+* Service Name: Dio_StageChannel
+* Service ID[hex]: 0x2B
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+*                  Level - Value to be staged.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stage the level of a channel in the update transaction opened by
+*              Dio_BeginUpdate, the hardware is written by Dio_Commit.
+************************************************************************************/
+void Dio_StageChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+	boolean error = FALSE;
+	DIO_PROFILE_BEGIN();
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_STAGE_CHANNEL_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if a transaction is open */
+	else if (FALSE == Dio_UpdateActive)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_STAGE_CHANNEL_SID, DIO_E_TRANSACTION);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_STAGE_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		Dio_ShadowChannel(&Dio_Channels[ChannelId], Level);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	DIO_PROFILE_END(DIO_STAGE_CHANNEL_SID);
+}
+
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+/************************************************************************************
+* Service Name: Dio_StageFlipChannel
+* Service ID[hex]: 0x2C
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_LevelType - Staged level of the channel after flip.
+* Description: Function to stage the flipped level of a channel in the update transaction
+*              opened by Dio_BeginUpdate. A channel not staged yet is flipped from its
+*              hardware level, a staged one from its staged level.
+************************************************************************************/
+Dio_LevelType Dio_StageFlipChannel(Dio_ChannelType ChannelId)
+{
+	Dio_LevelType output = STD_LOW;
+	boolean error = FALSE;
+	DIO_PROFILE_BEGIN();
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_STAGE_FLIP_CHANNEL_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if a transaction is open */
+	else if (FALSE == Dio_UpdateActive)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_STAGE_FLIP_CHANNEL_SID, DIO_E_TRANSACTION);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_STAGE_FLIP_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		output = Dio_ShadowFlipChannel(&Dio_Channels[ChannelId]);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	DIO_PROFILE_END(DIO_STAGE_FLIP_CHANNEL_SID);
+	return output;
+}
+#endif
+#endif
+
+/************************************************************************************
+* Service Name: Dio_ReadAllPorts
+* Service ID[hex]: 0x27
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Snapshot - Levels of all the ports.
+* Return value: None
+* Description: Function to read the levels of all the ports in one pass, one load per port
+*              used by the configuration. The ports not used by the configuration are not
+*              accessed (they may not be clocked) and read as zeros.
+************************************************************************************/
+void Dio_ReadAllPorts(Dio_PortsSnapshotType * Snapshot)
+{
+	DIO_PROFILE_BEGIN();
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_ALL_PORTS_SID, DIO_E_UNINIT);
+	}
+	/* Check if input pointer is not Null pointer */
+	else if (NULL_PTR == Snapshot)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_ALL_PORTS_SID, DIO_E_PARAM_POINTER);
+	}
+	else
+#endif
+	{
+		Dio_SnapshotPorts(Snapshot);
+	}
+	DIO_PROFILE_END(DIO_READ_ALL_PORTS_SID);
+}
+
+/************************************************************************************
+* Service Name: Dio_RefreshReadCache
+* Service ID[hex]: 0x28
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to take a new snapshot of the ports, to be called once at the start
+*              of each control cycle. Until the next call Dio_ReadChannel returns the levels
+*              of this snapshot without accessing the GPIO ports.
+************************************************************************************/
+#if (DIO_READ_CACHE == STD_ON)
+void Dio_RefreshReadCache(void)
+{
+	DIO_PROFILE_BEGIN();
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_REFRESH_READ_CACHE_SID, DIO_E_UNINIT);
+	}
+	else
+#endif
+	{
+		Dio_SnapshotPorts(&Dio_ReadCache);
+	}
+	DIO_PROFILE_END(DIO_REFRESH_READ_CACHE_SID);
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_DebounceMainFunction
+* Service ID[hex]: 0x24
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to be called periodically to debounce the inputs. Each port used by
+*              the configuration is read once and all its pins are debounced together with vertical counters:
+*              bit n of Dio_DebounceCount0/Dio_DebounceCount1 is the 2-bit counter of pin n,
+*              so every pin of 4 ports is processed by the same few 32-bit operations.
+*              A pin takes its new level after DIO_DEBOUNCE_SAMPLES consecutive equal samples.
+************************************************************************************/
+#if (DIO_DEBOUNCE_API == STD_ON)
+void Dio_DebounceMainFunction(void)
+{
+	uint32 Sample[DIO_DEBOUNCE_WORDS] = {0U};
+	uint32 Toggle;
+	uint8 PortNum;
+	uint8 Word;
+	DIO_PROFILE_BEGIN();
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_DEBOUNCE_MAIN_FUNCTION_SID, DIO_E_UNINIT);
+	}
+	else
+#endif
+	{
+		/* One GPIODATA read per scanned port */
+		for (PortNum = 0U; PortNum < DIO_NUMBER_OF_PORTS; PortNum++)
+		{
+			if (BIT_IS_SET(Dio_ActivePorts, PortNum))
+			{
+				Sample[PortNum / DIO_DEBOUNCE_PORTS_PER_WORD] |=
+					(uint32)(uint8)MMIO_READ32(DIO_GPIO_DATA_MASKED_ADDRESS(Dio_PortBaseAddress[PortNum], DIO_GPIO_ALL_PINS_MASK))
+					<< ((PortNum % DIO_DEBOUNCE_PORTS_PER_WORD) * DIO_NUMBER_OF_PORT_CHANNELS);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+
+		for (Word = 0U; Word < DIO_DEBOUNCE_WORDS; Word++)
+		{
+			if (FALSE == Dio_DebounceSeeded)
+			{
+				/* First sample is taken as the debounced level, without reporting edges */
+				Dio_DebounceState[Word]   = Sample[Word];
+				Dio_DebounceCount0[Word]  = 0xFFFFFFFFU;
+				Dio_DebounceCount1[Word]  = 0xFFFFFFFFU;
+				Dio_DebounceRising[Word]  = 0U;
+				Dio_DebounceFalling[Word] = 0U;
+			}
+			else
+			{
+				/* Pins whose sample differs from the debounced level count down, the others are reset */
+				Toggle = Dio_DebounceState[Word] ^ Sample[Word];
+				Dio_DebounceCount0[Word] = ~(Dio_DebounceCount0[Word] & Toggle);
+				Dio_DebounceCount1[Word] = Dio_DebounceCount0[Word] ^ (Dio_DebounceCount1[Word] & Toggle);
+
+				/* Pins whose counter wrapped take the new level */
+				Toggle &= Dio_DebounceCount0[Word] & Dio_DebounceCount1[Word];
+				Dio_DebounceState[Word] ^= Toggle;
+
+				Dio_DebounceRising[Word]  |= Toggle & Dio_DebounceState[Word];
+				Dio_DebounceFalling[Word] |= Toggle & ~Dio_DebounceState[Word];
+			}
+		}
+		Dio_DebounceSeeded = TRUE;
+	}
+	DIO_PROFILE_END(DIO_DEBOUNCE_MAIN_FUNCTION_SID);
+}
+
+/************************************************************************************
+* Service Name: Dio_ReadDebouncedChannel
+* Service ID[hex]: 0x25
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_LevelType
+* Description: Function to return the debounced level of the specified DIO channel,
+*              it is read from RAM without accessing the GPIO port.
+************************************************************************************/
+Dio_LevelType Dio_ReadDebouncedChannel(Dio_ChannelType ChannelId)
+{
+	Dio_LevelType output = STD_LOW;
+	boolean error = FALSE;
+	DIO_PROFILE_BEGIN();
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_DEBOUNCED_CHANNEL_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_DEBOUNCED_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if (FALSE == error)
+	{
+		const Dio_ChannelRuntimeType * Channel = &Dio_Channels[ChannelId];
+
+		if (Dio_DebounceState[DIO_DEBOUNCE_WORD(Channel)] & DIO_DEBOUNCE_BIT(Channel))
+		{
+			output = STD_HIGH;
+		}
+		else
+		{
+			output = STD_LOW;
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	DIO_PROFILE_END(DIO_READ_DEBOUNCED_CHANNEL_SID);
+	return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_GetDebouncedEdges
+* Service ID[hex]: 0x26
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Rising - Bitmap of the channels whose debounced level became STD_HIGH.
+*                   Falling - Bitmap of the channels whose debounced level became STD_LOW.
+* Return value: None
+* Description: Function to return the edges latched by Dio_DebounceMainFunction since the
+*              previous call, bit n of each bitmap is channel n. The returned edges are
+*              cleared. Shall be called from the same task as Dio_DebounceMainFunction.
+************************************************************************************/
+void Dio_GetDebouncedEdges(uint32 * Rising, uint32 * Falling)
+{
+	uint8 Index;
+	uint32 RisingEdges = 0U;
+	uint32 FallingEdges = 0U;
+	DIO_PROFILE_BEGIN();
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_GET_DEBOUNCED_EDGES_SID, DIO_E_UNINIT);
+	}
+	/* Check if the output pointers are not Null pointers */
+	else if ((NULL_PTR == Rising) || (NULL_PTR == Falling))
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_GET_DEBOUNCED_EDGES_SID, DIO_E_PARAM_POINTER);
+	}
+	else
+#endif
+	{
+		for (Index = 0U; (Index < DIO_CONFIGURED_CHANNLES) && (Index < DIO_MAX_READ_CHANNELS); Index++)
+		{
+			const Dio_ChannelRuntimeType * Channel = &Dio_Channels[Index];
+
+			if (Dio_DebounceRising[DIO_DEBOUNCE_WORD(Channel)] & DIO_DEBOUNCE_BIT(Channel))
+			{
+				RisingEdges |= ((uint32)1U << Index);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+			if (Dio_DebounceFalling[DIO_DEBOUNCE_WORD(Channel)] & DIO_DEBOUNCE_BIT(Channel))
+			{
+				FallingEdges |= ((uint32)1U << Index);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+		for (Index = 0U; Index < DIO_DEBOUNCE_WORDS; Index++)
+		{
+			Dio_DebounceRising[Index]  = 0U;
+			Dio_DebounceFalling[Index] = 0U;
+		}
+		*Rising  = RisingEdges;
+		*Falling = FallingEdges;
+	}
+	DIO_PROFILE_END(DIO_GET_DEBOUNCED_EDGES_SID);
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_ReadPort
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to return the level of all channels of that port.
+************************************************************************************/
+Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
+{
+	Dio_PortLevelType output = STD_LOW;
+	boolean error = FALSE;
+	DIO_PROFILE_BEGIN();
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_PORT_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used port is within the valid range */
+	if (DIO_CONFIGURED_PORTS <= PortId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Read all the port channels with one access to the full GPIODATA register */
+		output = (Dio_PortLevelType)MMIO_READ32(DIO_GPIO_DATA_MASKED_ADDRESS(Dio_PortsBase[PortId], DIO_GPIO_ALL_PINS_MASK));
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	DIO_PROFILE_END(DIO_READ_PORT_SID);
+        return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_WritePort
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+*                  Level - Value to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set a value of the port.
+************************************************************************************/
+void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level)
+{
+	boolean error = FALSE;
+	DIO_PROFILE_BEGIN();
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_PORT_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used port is within the valid range */
+	if (DIO_CONFIGURED_PORTS <= PortId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Write all the port channels with one store to the full GPIODATA register */
+		MMIO_WRITE32(DIO_GPIO_DATA_MASKED_ADDRESS(Dio_PortsBase[PortId], DIO_GPIO_ALL_PINS_MASK), Level);
+		DIO_TRACE(DIO_WRITE_PORT_SID, PortId, Level);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	DIO_PROFILE_END(DIO_WRITE_PORT_SID);
+}
+
+/************************************************************************************
+* Service Name: Dio_MaskedWritePort
+* Service ID[hex]: 0x13
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+*                  Level - Value to be written.
+*                  Mask - Channels to be modified, bit n set --> channel n takes bit n of Level.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the value of the masked channels of a port, the other channels
+*              keep their value. The update is one store to the GPIODATA masked alias without
+*              reading back, so callers owning disjoint bits of the same port (e.g. an ISR and
+*              a task) need no critical section.
+************************************************************************************/
+#if (DIO_MASKED_WRITE_PORT_API == STD_ON)
+void Dio_MaskedWritePort(Dio_PortType PortId, Dio_PortLevelType Level, Dio_PortLevelType Mask)
+{
+	boolean error = FALSE;
+	DIO_PROFILE_BEGIN();
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_MASKED_WRITE_PORT_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used port is within the valid range */
+	if (DIO_CONFIGURED_PORTS <= PortId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_MASKED_WRITE_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* The hardware ignores the Level bits outside Mask */
+		MMIO_WRITE32(DIO_GPIO_DATA_MASKED_ADDRESS(Dio_PortsBase[PortId], Mask), Level);
+		DIO_TRACE(DIO_MASKED_WRITE_PORT_SID, PortId, Level);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	DIO_PROFILE_END(DIO_MASKED_WRITE_PORT_SID);
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_ReadChannelGroup
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to read a subset of the adjoining bits of a port, shifted to the LSB.
+************************************************************************************/
+Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr)
+{
+	Dio_PortLevelType output = STD_LOW;
+	boolean error = FALSE;
+	DIO_PROFILE_BEGIN();
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_GROUP_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if the used group is one of the configured channel groups */
+	else if ((ChannelGroupIdPtr < Dio_GroupsConfig)
+	      || (ChannelGroupIdPtr >= (Dio_GroupsConfig + DIO_CONFIGURED_CHANNEL_GROUPS)))
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Runtime entry holding the masked alias and the offset of this group */
+		const Dio_ChannelGroupRuntimeType * Group = &Dio_Groups[ChannelGroupIdPtr - Dio_GroupsConfig];
+
+		/* The masked alias reads the bits outside the group as zeros */
+		output = (Dio_PortLevelType)(MMIO_READ32(Group->Data_Address) >> Group->Offset);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	DIO_PROFILE_END(DIO_READ_CHANNEL_GROUP_SID);
+        return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_WriteChannelGroup
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+*                  Level - Value to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set a subset of the adjoining bits of a port to a specified level.
+************************************************************************************/
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr, Dio_PortLevelType Level)
+{
+	boolean error = FALSE;
+	DIO_PROFILE_BEGIN();
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if the used group is one of the configured channel groups */
+	else if ((ChannelGroupIdPtr < Dio_GroupsConfig)
+	      || (ChannelGroupIdPtr >= (Dio_GroupsConfig + DIO_CONFIGURED_CHANNEL_GROUPS)))
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Runtime entry holding the masked alias and the offset of this group */
+		const Dio_ChannelGroupRuntimeType * Group = &Dio_Groups[ChannelGroupIdPtr - Dio_GroupsConfig];
+
+		/* The masked alias drops the bits outside the group, all group bits change in one store */
+		MMIO_WRITE32(Group->Data_Address, ((uint32)Level << Group->Offset));
+		DIO_TRACE(DIO_WRITE_CHANNEL_GROUP_SID, ChannelGroupIdPtr - Dio_GroupsConfig, Level);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	DIO_PROFILE_END(DIO_WRITE_CHANNEL_GROUP_SID);
+}
+
+/************************************************************************************
+* Service Name: Dio_TraceDump
+* Service ID[hex]: 0x29
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Size - Number of records Buffer can hold.
+* Parameters (inout): None
+* Parameters (out): Buffer - Newest trace records, oldest first.
+* Return value: uint32 - Number of records copied to Buffer.
+* Description: Function to export the write trace, the ring is left unchanged.
+************************************************************************************/
+#if (DIO_TRACE_API == STD_ON)
+uint32 Dio_TraceDump(Dio_TraceRecordType * Buffer, uint32 Size)
+{
+	uint32 Copied = 0U;
+	uint32 Count = Dio_TraceCount;
+	uint32 Available = (Count < DIO_TRACE_RING_SIZE) ? Count : DIO_TRACE_RING_SIZE;
+	uint32 Index;
+	DIO_PROFILE_BEGIN();
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if input pointer is not Null pointer */
+	if (NULL_PTR == Buffer)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_TRACE_DUMP_SID, DIO_E_PARAM_POINTER);
+	}
+	else
+#endif
+	{
+		Copied = (Size < Available) ? Size : Available;
+		for (Index = 0U; Index < Copied; Index++)
+		{
+			Buffer[Index] = Dio_TraceRing[(Count - Copied + Index) & (DIO_TRACE_RING_SIZE - 1U)];
+		}
+	}
+	DIO_PROFILE_END(DIO_TRACE_DUMP_SID);
+	return Copied;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_GetProfile
+* Service ID[hex]: 0x2A
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ServiceId - ID of the Dio service (DIO_*_SID).
+* Parameters (inout): None
+* Parameters (out): Result - Count, min, max and mean duration of the service in cycles.
+* Return value: Std_ReturnType - E_NOT_OK if the service is not profiled or was never measured.
+* Description: Function to return the cycle count statistics of a Dio service.
+************************************************************************************/
+#if (DIO_PROFILING_API == STD_ON)
+Std_ReturnType Dio_GetProfile(uint8 ServiceId, Profiling_ResultType * Result)
+{
+	Std_ReturnType ret = E_NOT_OK;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if input pointer is not Null pointer */
+	if (NULL_PTR == Result)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_GET_PROFILE_SID, DIO_E_PARAM_POINTER);
+	}
+	else
+#endif
+	if (ServiceId < DIO_PROFILING_SIDS)
+	{
+		ret = Profiling_GetResult(&Dio_Profile[ServiceId], Result);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return ret;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_GetVersionInfo
+* Service ID[hex]: 0x12
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): VersionInfo - Pointer to where to store the version information of this module.
+* Return value: None
+* Description: Function to get the version information of this module.
+************************************************************************************/
+#if (DIO_VERSION_INFO_API == STD_ON)
+void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo)
+{
+	DIO_PROFILE_BEGIN();
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if input pointer is not Null pointer */
+	if(NULL_PTR == versioninfo)
+	{
+		/* Report to DET  */
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_GET_VERSION_INFO_SID, DIO_E_PARAM_POINTER);
+	}
+	else
+#endif /* (DIO_DEV_ERROR_DETECT == STD_ON) */
+	{
+		/* Copy the vendor Id */
+		versioninfo->vendorID = (uint16)DIO_VENDOR_ID;
+		/* Copy the module Id */
+		versioninfo->moduleID = (uint16)DIO_MODULE_ID;
+		/* Copy Software Major Version */
+		versioninfo->sw_major_version = (uint8)DIO_SW_MAJOR_VERSION;
+		/* Copy Software Minor Version */
+		versioninfo->sw_minor_version = (uint8)DIO_SW_MINOR_VERSION;
+		/* Copy Software Patch Version */
+		versioninfo->sw_patch_version = (uint8)DIO_SW_PATCH_VERSION;
+	}
+	DIO_PROFILE_END(DIO_GET_VERSION_INFO_SID);
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_FlipChannel
+* Service ID[hex]: 0x11
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_LevelType
+* Description: Function to flip the level of a channel and return the level of the channel after flip.
+************************************************************************************/
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
+{
+	Dio_LevelType output = STD_LOW;
+	boolean error = FALSE;
+	DIO_PROFILE_BEGIN();
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_FLIP_CHANNEL_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_FLIP_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Runtime entry holding the DATA register address and the mask of this channel */
+		const Dio_ChannelRuntimeType * Channel = &Dio_Channels[ChannelId];
+
+		/* Read the required channel and write the required level */
+		if(MMIO_READ32(Channel->Data_Address) & Channel->Mask)
+		{
+#if (DIO_CHANNEL_ACCESS_MODE != DIO_CHANNEL_ACCESS_RMW)
+			MMIO_WRITE32(Channel->Data_Address, 0U);
+#else
+			MMIO_CLEAR_BITS32(Channel->Data_Address, Channel->Mask);
+#endif
+			output = STD_LOW;
+			DIO_TRACE(DIO_FLIP_CHANNEL_SID, ChannelId, output);
+		}
+		else
+		{
+#if (DIO_CHANNEL_ACCESS_MODE != DIO_CHANNEL_ACCESS_RMW)
+			MMIO_WRITE32(Channel->Data_Address, Channel->Mask);
+#else
+			MMIO_SET_BITS32(Channel->Data_Address, Channel->Mask);
+#endif
 			output = STD_HIGH;
+			DIO_TRACE(DIO_FLIP_CHANNEL_SID, ChannelId, output);
 		}
 	}
 	else
 	{
 		/* No Action Required */
 	}
+	DIO_PROFILE_END(DIO_FLIP_CHANNEL_SID);
         return output;
 }
 #endif
@@ -42,6 +42,29 @@
 #define DIO_INITIALIZED                (1U)
 #define DIO_NOT_INITIALIZED            (0U)
 
+/*
+ * Number of GPIO ports available in TM4C123GH6PM (PORTA --> PORTF)
+ * and the number of channels in each port
+ */
+#define DIO_NUMBER_OF_PORTS            (6U)
+#define DIO_NUMBER_OF_PORT_CHANNELS    (8U)
+
+/* Number of profiled service IDs, the highest service ID (DIO_STAGE_FLIP_CHANNEL_SID) + 1 */
+#define DIO_PROFILING_SIDS             (0x2DU)
+
+/* Maximum number of channels read by one Dio_ReadChannels call (bits of its result) */
+#define DIO_MAX_READ_CHANNELS          (32U)
+
+/*
+ * The debounce engine packs the pins of DIO_DEBOUNCE_PORTS_PER_WORD ports in each 32-bit word,
+ * pin n of port p is bit ((p % 4) * 8 + n) of word (p / 4).
+ */
+#define DIO_DEBOUNCE_PORTS_PER_WORD    (4U)
+#define DIO_DEBOUNCE_WORDS             ((DIO_NUMBER_OF_PORTS + DIO_DEBOUNCE_PORTS_PER_WORD - 1U) / DIO_DEBOUNCE_PORTS_PER_WORD)
+
+/* Number of consecutive equal samples needed to accept a new level (fixed by the 2-bit vertical counters) */
+#define DIO_DEBOUNCE_SAMPLES           (4U)
+
 /* Standard AUTOSAR types */
 #include "Std_Types.h"
 
@@ -71,6 +94,9 @@
 
 /* Non AUTOSAR files */
 #include "Common_Macros.h"
+#if (DIO_PROFILING_API == STD_ON)
+#include "Profiling.h"
+#endif
 
 /******************************************************************************
  *                      API Service Id Macros                                 *
@@ -102,6 +128,48 @@
 /* Service ID for DIO flip Channel */
 #define DIO_FLIP_CHANNEL_SID           (uint8)0x11
 
+/* Service ID for DIO masked write Port (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_MASKED_WRITE_PORT_SID      (uint8)0x13
+
+/* Service ID for DIO begin update (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_BEGIN_UPDATE_SID           (uint8)0x22
+
+/* Service ID for DIO commit (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_COMMIT_SID                 (uint8)0x23
+
+/* Service ID for DIO debounce main function (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_DEBOUNCE_MAIN_FUNCTION_SID (uint8)0x24
+
+/* Service ID for DIO read debounced Channel (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_READ_DEBOUNCED_CHANNEL_SID (uint8)0x25
+
+/* Service ID for DIO get debounced edges (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_GET_DEBOUNCED_EDGES_SID    (uint8)0x26
+
+/* Service ID for DIO read all Ports (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_READ_ALL_PORTS_SID         (uint8)0x27
+
+/* Service ID for DIO refresh read cache (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_REFRESH_READ_CACHE_SID     (uint8)0x28
+
+/* Service ID for DIO trace dump (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_TRACE_DUMP_SID             (uint8)0x29
+
+/* Service ID for DIO get profile (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_GET_PROFILE_SID            (uint8)0x2A
+
+/* Service ID for DIO write Channels (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_WRITE_CHANNELS_SID         (uint8)0x20
+
+/* Service ID for DIO read Channels (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_READ_CHANNELS_SID          (uint8)0x21
+
+/* Service ID for DIO stage Channel (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_STAGE_CHANNEL_SID          (uint8)0x2B
+
+/* Service ID for DIO stage flip Channel (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_STAGE_FLIP_CHANNEL_SID     (uint8)0x2C
+
 /*******************************************************************************
  *                      DET Error Codes                                        *
  *******************************************************************************/
@@ -128,6 +196,18 @@
  * error code (Not exist in AUTOSAR 4.0.3 DIO SWS Document.
  */
 #define DIO_E_UNINIT                   (uint8)0xF0
+
+/*
+ * Dio_ReadChannels API service called with more channels than its result bitmap can hold
+ * (Not exist in AUTOSAR 4.0.3 DIO SWS Document).
+ */
+#define DIO_E_PARAM_LENGTH             (uint8)0xF1
+
+/*
+ * Dio_BeginUpdate API service called inside an update transaction, or Dio_StageChannel,
+ * Dio_StageFlipChannel and Dio_Commit called outside one (Not exist in AUTOSAR 4.0.3 DIO SWS Document).
+ */
+#define DIO_E_TRANSACTION              (uint8)0xF3
 /*******************************************************************************
  *                              Module Data Types                              *
  *******************************************************************************/
@@ -151,7 +231,7 @@ typedef struct
   uint8 mask;
   /* Position of the group from LSB */
   uint8 offset;
-  /* This shall be the port ID which the Channel group is defined. */
+  /* This shall be the port ID which the Channel group is defined (index in the configured Ports). */
   Dio_PortType PortIndex;
 } Dio_ChannelGroupType;
 
@@ -163,31 +243,156 @@ typedef struct
 	Dio_ChannelType Ch_Num;
 }Dio_ConfigChannel;
 
+typedef struct
+{
+	/* Member contains the ID of the hardware Port (0 --> PORTA ... 5 --> PORTF) */
+	Dio_PortType Port_Num;
+}Dio_ConfigPort;
+
+/*
+ * Runtime channel entry resolved by Dio_Init from Dio_ConfigChannel so the
+ * channel services need no port lookup at runtime.
+ */
+typedef struct
+{
+	/* Address of the GPIO DATA register of the port this channel belongs to, or of its
+	 * masked/bit-band alias according to DIO_CHANNEL_ACCESS_MODE */
+	uint32 Data_Address;
+	/* Bit mask of the channel inside the word at Data_Address */
+	uint32 Mask;
+	/* ID of the hardware Port this channel belongs to */
+	Dio_PortType Port_Num;
+	/* Bit mask of the channel inside its GPIO port */
+	uint8 Pin_Mask;
+}Dio_ChannelRuntimeType;
+
+/* Levels of all the GPIO ports taken in one pass, Levels[n] is port n (0 --> PORTA ... 5 --> PORTF) */
+typedef struct
+{
+	Dio_PortLevelType Levels[DIO_NUMBER_OF_PORTS];
+}Dio_PortsSnapshotType;
+
+/*
+ * Write trace record: Sid is the service which wrote the hardware, Id is the channel ID for
+ * the channel services, the port ID for the port services, the group index for the group
+ * services and the hardware port for Dio_WriteChannels/Dio_Commit, Value is the written level.
+ */
+typedef struct
+{
+	/* DWT cycle counter value when the record was taken */
+	uint32 Cycles;
+	uint8 Sid;
+	uint8 Id;
+	uint8 Value;
+}Dio_TraceRecordType;
+
+/*
+ * Runtime channel group entry resolved by Dio_Init from Dio_ChannelGroupType so a
+ * group write is one shift and one store.
+ */
+typedef struct
+{
+	/* Address of the masked alias of the GPIO DATA register covering only the group bits */
+	uint32 Data_Address;
+	/* Position of the group from LSB */
+	uint8 Offset;
+}Dio_ChannelGroupRuntimeType;
+
 /* Data Structure required for initializing the Dio Driver */
 typedef struct Dio_ConfigType
 {
 	Dio_ConfigChannel Channels[DIO_CONFIGURED_CHANNLES];
+	Dio_ConfigPort Ports[DIO_CONFIGURED_PORTS];
+	Dio_ChannelGroupType Groups[DIO_CONFIGURED_CHANNEL_GROUPS];
 } Dio_ConfigType;
 
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
 
-/* Function for DIO read Channel API */
+/* Function for DIO read Port API */
 Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId);
 
-/* Function for DIO write Channel API */
+/* Function for DIO write Port API */
 void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level);
 
-/* Function for DIO read Port API */
+#if (DIO_MASKED_WRITE_PORT_API == STD_ON)
+/* Function for DIO masked write Port API */
+void Dio_MaskedWritePort(Dio_PortType PortId, Dio_PortLevelType Level, Dio_PortLevelType Mask);
+#endif
+
+/* Function for DIO read Channel API */
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId);
 
-/* Function for DIO write Port API */
+/* Function for DIO write Channel API */
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level);
 
+/* Function for DIO read Channel Group API */
+Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr);
+
+/* Function for DIO write Channel Group API */
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr, Dio_PortLevelType Level);
+
+#if (DIO_MULTI_CHANNEL_API == STD_ON)
+/* Function for DIO write Channels API */
+void Dio_WriteChannels(const Dio_ChannelType * ChannelIds, const Dio_LevelType * Levels, uint8 NumberOfChannels);
+
+/* Function for DIO read Channels API */
+uint32 Dio_ReadChannels(const Dio_ChannelType * ChannelIds, uint8 NumberOfChannels);
+#endif
+
+#if (DIO_STAGED_UPDATE_API == STD_ON)
+/* Function for DIO begin update API */
+void Dio_BeginUpdate(void);
+
+/* Function for DIO commit API */
+void Dio_Commit(void);
+
+/* Function to stage the level of a channel in the update transaction */
+void Dio_StageChannel(Dio_ChannelType ChannelId, Dio_LevelType Level);
+
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+/* Function to stage the flipped level of a channel in the update transaction */
+Dio_LevelType Dio_StageFlipChannel(Dio_ChannelType ChannelId);
+#endif
+#endif
+
+#if (DIO_DEBOUNCE_API == STD_ON)
+/* Function to sample and debounce the input ports, called periodically */
+void Dio_DebounceMainFunction(void);
+
+/* Function for DIO read debounced Channel API */
+Dio_LevelType Dio_ReadDebouncedChannel(Dio_ChannelType ChannelId);
+
+/* Function to return and clear the channels that became high (Rising) or low (Falling) */
+void Dio_GetDebouncedEdges(uint32 * Rising, uint32 * Falling);
+#endif
+
+/* Function to read the levels of all the ports used by the configuration in one pass */
+void Dio_ReadAllPorts(Dio_PortsSnapshotType * Snapshot);
+
+#if (DIO_READ_CACHE == STD_ON)
+/* Function to refresh the snapshot Dio_ReadChannel is served from */
+void Dio_RefreshReadCache(void);
+#endif
+
+#if (DIO_TRACE_API == STD_ON)
+/* Function to copy the newest trace records, oldest first, returns the number of records copied */
+uint32 Dio_TraceDump(Dio_TraceRecordType * Buffer, uint32 Size);
+#endif
+
+#if (DIO_PROFILING_API == STD_ON)
+/* Function to return the cycle count statistics of the service ServiceId (a DIO_*_SID value) */
+Std_ReturnType Dio_GetProfile(uint8 ServiceId, Profiling_ResultType * Result);
+#endif
+
 /* Function for DIO Initialization API */
 void Dio_Init(const Dio_ConfigType * ConfigPtr);
 
+/* Function to return the base address of the configured port PortId resolved by Dio_Init,
+ * 0 before Dio_Init or for an invalid PortId. Used by the Dio sub-modules (Dio_Pattern.c) */
+uint32 Dio_GetPortBaseAddress(Dio_PortType PortId);
+
 #if (DIO_FLIP_CHANNEL_API == STD_ON)
 /* Function for DIO flip channel API */
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId);
@@ -205,4 +410,58 @@ void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo);
 /* Extern PB structures to be used by Dio and other modules */
 extern const Dio_ConfigType Dio_Configuration;
 
+#if (DIO_DEV_ERROR_DETECT == STD_OFF)
+/*******************************************************************************
+ *                      Inline Channel Accessors                               *
+ *******************************************************************************/
+/*
+ * Without development error detection the configured channels are also accessible
+ * through static inline accessors Dio_Write_<NAME>/Dio_Read_<NAME> generated from the
+ * DIO_CFG_CHANNELS list of Dio_Cfg.h. Their register address and mask fold to
+ * constants, so each accessor compiles to a single load or store on the GPIODATA
+ * masked alias of the channel.
+ */
+#include "Dio_Regs.h"
+
+/* Address of the masked alias of channel CH_NUM of port PORT_NUM */
+#define DIO_CHANNEL_MASKED_ADDRESS(PORT_NUM,CH_NUM) \
+  DIO_GPIO_DATA_MASKED_ADDRESS(DIO_GPIO_PORT_BASE_ADDRESS(PORT_NUM), ((uint32)1U << (CH_NUM)))
+
+/* Write LEVEL (STD_HIGH/STD_LOW) to channel CH_NUM of port PORT_NUM, like Dio_WriteChannel
+ * any other level is ignored */
+#define DIO_INLINE_WRITE_CHANNEL(PORT_NUM,CH_NUM,LEVEL) \
+	do \
+	{ \
+		if (STD_HIGH == (LEVEL)) \
+		{ \
+			MMIO_WRITE32(DIO_CHANNEL_MASKED_ADDRESS(PORT_NUM, CH_NUM), ((uint32)1U << (CH_NUM))); \
+		} \
+		else if (STD_LOW == (LEVEL)) \
+		{ \
+			MMIO_WRITE32(DIO_CHANNEL_MASKED_ADDRESS(PORT_NUM, CH_NUM), 0U); \
+		} \
+		else \
+		{ \
+			/* No Action Required */ \
+		} \
+	} while (0)
+
+/* Read the level of channel CH_NUM of port PORT_NUM, the alias reads the other bits as zeros */
+#define DIO_INLINE_READ_CHANNEL(PORT_NUM,CH_NUM) \
+  ((Dio_LevelType)(MMIO_READ32(DIO_CHANNEL_MASKED_ADDRESS(PORT_NUM, CH_NUM)) >> (CH_NUM)))
+
+/* Dio_Write_<NAME> and Dio_Read_<NAME> accessors of one DIO_CFG_CHANNELS entry */
+#define DIO_INLINE_ACCESSORS(NAME,PORT_NUM,CH_NUM) \
+	LOCAL_INLINE void Dio_Write_##NAME(Dio_LevelType Level) \
+	{ \
+		DIO_INLINE_WRITE_CHANNEL(PORT_NUM, CH_NUM, Level); \
+	} \
+	LOCAL_INLINE Dio_LevelType Dio_Read_##NAME(void) \
+	{ \
+		return DIO_INLINE_READ_CHANNEL(PORT_NUM, CH_NUM); \
+	}
+
+DIO_CFG_CHANNELS(DIO_INLINE_ACCESSORS)
+#endif /* (DIO_DEV_ERROR_DETECT == STD_OFF) */
+
 #endif /* DIO_H */
@@ -0,0 +1,193 @@
+ /******************************************************************************
+ *
+ * Module: Dio
+ *
+ * File Name: Dio_Capture.c
+ *
+ * Description: Source file for TM4C123GH6PM Microcontroller - Dio Edge Capture.
+ *              The GPIO ISRs push timestamped edge events into a lock-free ring.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Dio_Capture.h"
+#include "Dio_Regs.h"
+
+#if (DIO_CAPTURE_API == STD_ON)
+
+/* DWT cycle counter used to timestamp the events */
+#include "Profiling.h"
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Dio Modules */
+#if ((DET_AR_MAJOR_VERSION != DIO_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != DIO_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != DIO_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+/*
+ * Single producer (the GPIO ISRs, which share one priority level) / single consumer
+ * (the application) ring. Dio_CaptureHead is only written by the ISRs and
+ * Dio_CaptureTail only by Dio_CaptureRead, so no lock is needed. One slot is left
+ * free to distinguish a full ring from an empty one.
+ */
+STATIC volatile Dio_CaptureEventType Dio_CaptureRing[DIO_CAPTURE_RING_SIZE];
+STATIC volatile uint8 Dio_CaptureHead = 0U;
+STATIC volatile uint8 Dio_CaptureTail = 0U;
+
+/* Number of events dropped because the ring was full */
+STATIC volatile uint32 Dio_CaptureOverflows = 0U;
+
+/************************************************************************************
+* Service Name: Dio_CaptureInit
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start the DWT cycle counter used as event timestamp and to
+*              empty the ring. Shall be called before the pin interrupts are enabled.
+************************************************************************************/
+void Dio_CaptureInit(void)
+{
+	PROFILING_START_CYCLE_COUNTER();
+
+	Dio_CaptureHead      = 0U;
+	Dio_CaptureTail      = 0U;
+	Dio_CaptureOverflows = 0U;
+}
+
+/************************************************************************************
+* Service Name: Dio_CaptureRead
+* Service ID[hex]: 0x32
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Event - Oldest captured event.
+* Return value: Std_ReturnType - E_OK if an event was read, E_NOT_OK if the ring is empty.
+* Description: Function to take the oldest event from the capture ring.
+************************************************************************************/
+Std_ReturnType Dio_CaptureRead(Dio_CaptureEventType * Event)
+{
+	Std_ReturnType ret = E_NOT_OK;
+	uint8 Tail = Dio_CaptureTail;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if input pointer is not Null pointer */
+	if (NULL_PTR == Event)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_CAPTURE_READ_SID, DIO_E_PARAM_POINTER);
+	}
+	else
+#endif
+	if (Tail != Dio_CaptureHead)
+	{
+		/* Copy the event before releasing its slot to the ISR */
+		Event->Timestamp = Dio_CaptureRing[Tail].Timestamp;
+		Event->Port_Num  = Dio_CaptureRing[Tail].Port_Num;
+		Event->Pins      = Dio_CaptureRing[Tail].Pins;
+		Event->Levels    = Dio_CaptureRing[Tail].Levels;
+		Dio_CaptureTail  = (uint8)((Tail + 1U) & (DIO_CAPTURE_RING_SIZE - 1U));
+		ret = E_OK;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return ret;
+}
+
+/************************************************************************************
+* Service Name: Dio_CaptureGetOverflows
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of events lost since Dio_CaptureInit.
+* Description: Function to return the number of events dropped because the ring was full.
+************************************************************************************/
+uint32 Dio_CaptureGetOverflows(void)
+{
+	return Dio_CaptureOverflows;
+}
+
+/************************************************************************************
+* Service Name: Dio_CaptureIsr
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): PortNum - GPIO port which raised the interrupt, 0 --> PORTA ... 5 --> PORTF.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to capture the pending edges of a port as one event. All the pins
+*              pending together share the event, so the cost is a fixed number of register
+*              accesses whatever the number of pins with interrupts.
+************************************************************************************/
+void Dio_CaptureIsr(Dio_PortType PortNum)
+{
+	uint32 Timestamp = MMIO_READ32(DWT_CYCCNT_ADDRESS);
+	uint32 Base = DIO_GPIO_PORT_BASE_ADDRESS(PortNum);
+	uint8 Pins = (uint8)MMIO_READ32(DIO_GPIO_MIS_ADDRESS(Base));
+	uint8 Head = Dio_CaptureHead;
+	uint8 Next = (uint8)((Head + 1U) & (DIO_CAPTURE_RING_SIZE - 1U));
+
+	/* Acknowledge the captured edges, an edge arriving after this point raises a new interrupt */
+	MMIO_WRITE32(DIO_GPIO_ICR_ADDRESS(Base), Pins);
+
+	if (Next != Dio_CaptureTail)
+	{
+		Dio_CaptureRing[Head].Timestamp = Timestamp;
+		Dio_CaptureRing[Head].Port_Num  = PortNum;
+		Dio_CaptureRing[Head].Pins      = Pins;
+		/* One read of the masked DATA alias returns the levels of the captured pins only */
+		Dio_CaptureRing[Head].Levels    = (uint8)MMIO_READ32(DIO_GPIO_DATA_MASKED_ADDRESS(Base, Pins));
+		/* Publish the event once it is complete */
+		Dio_CaptureHead = Next;
+	}
+	else
+	{
+		Dio_CaptureOverflows++;
+	}
+}
+
+/* GPIO ports ISRs, override the weak handlers of cstartup_M.c */
+void GPIOPortA_Handler(void)
+{
+	Dio_CaptureIsr(0U);
+}
+
+void GPIOPortB_Handler(void)
+{
+	Dio_CaptureIsr(1U);
+}
+
+void GPIOPortC_Handler(void)
+{
+	Dio_CaptureIsr(2U);
+}
+
+void GPIOPortD_Handler(void)
+{
+	Dio_CaptureIsr(3U);
+}
+
+void GPIOPortE_Handler(void)
+{
+	Dio_CaptureIsr(4U);
+}
+
+void GPIOPortF_Handler(void)
+{
+	Dio_CaptureIsr(5U);
+}
+
+#endif /* (DIO_CAPTURE_API == STD_ON) */
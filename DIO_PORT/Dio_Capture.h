@@ -0,0 +1,65 @@
+ /******************************************************************************
+ *
+ * Module: Dio
+ *
+ * File Name: Dio_Capture.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Dio Edge Capture.
+ *              The GPIO ISRs push timestamped edge events into a lock-free ring.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef DIO_CAPTURE_H
+#define DIO_CAPTURE_H
+
+#include "Dio.h"
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for DIO capture read event (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_CAPTURE_READ_SID           (uint8)0x32
+
+/*******************************************************************************
+ *                              Module Definitions                             *
+ *******************************************************************************/
+
+#if ((DIO_CAPTURE_RING_SIZE & (DIO_CAPTURE_RING_SIZE - 1U)) != 0U) || (DIO_CAPTURE_RING_SIZE > 256U)
+  #error "DIO_CAPTURE_RING_SIZE shall be a power of two not greater than 256"
+#endif
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Edge event captured by one GPIO interrupt */
+typedef struct
+{
+	/* DWT cycle counter value when the ISR sampled the port */
+	uint32 Timestamp;
+	/* GPIO port of the event, 0 --> PORTA ... 5 --> PORTF */
+	Dio_PortType Port_Num;
+	/* Pins of the port whose edge raised the interrupt (bit n for pin n) */
+	uint8 Pins;
+	/* Levels of those pins after the edge (bit n for pin n) */
+	uint8 Levels;
+}Dio_CaptureEventType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function to start the cycle counter used as timestamp and empty the ring */
+void Dio_CaptureInit(void);
+
+/* Function to take the oldest event from the ring, returns E_NOT_OK if the ring is empty */
+Std_ReturnType Dio_CaptureRead(Dio_CaptureEventType * Event);
+
+/* Function to return the number of events lost because the ring was full */
+uint32 Dio_CaptureGetOverflows(void);
+
+/* Function called by the GPIO ISR of port PortNum to capture its pending edges */
+void Dio_CaptureIsr(Dio_PortType PortNum);
+
+#endif /* DIO_CAPTURE_H */
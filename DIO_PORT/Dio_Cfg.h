@@ -35,19 +35,118 @@
 /* Pre-compile option for presence of Dio_FlipChannel API */
 #define DIO_FLIP_CHANNEL_API                (STD_ON)
 
+/* Pre-compile option for presence of Dio_MaskedWritePort API */
+#define DIO_MASKED_WRITE_PORT_API           (STD_ON)
+
+/* Pre-compile option for presence of Dio_WriteChannels/Dio_ReadChannels APIs */
+#define DIO_MULTI_CHANNEL_API               (STD_ON)
+
+/* Pre-compile option for presence of the Dio_BeginUpdate/Dio_StageChannel/Dio_Commit staged output updates */
+#define DIO_STAGED_UPDATE_API               (STD_ON)
+
+/* Pre-compile option for presence of the debounced input scanner (Dio_DebounceMainFunction) */
+#define DIO_DEBOUNCE_API                    (STD_ON)
+
+/* Pre-compile option to serve Dio_ReadChannel from the snapshot taken by the last
+ * Dio_RefreshReadCache call instead of reading the GPIO port, the host tests also
+ * build the drivers with it on */
+#ifndef DIO_READ_CACHE
+#define DIO_READ_CACHE                      (STD_OFF)
+#endif
+
+/* Pre-compile option for the write trace ring, when STD_OFF the trace points compile to nothing,
+ * the host tests also build the drivers with it on */
+#ifndef DIO_TRACE_API
+#define DIO_TRACE_API                       (STD_OFF)
+#endif
+
+/* Number of records held by the write trace ring, shall be a power of two */
+#define DIO_TRACE_RING_SIZE                 (64U)
+
+/* Pre-compile option for the cycle count profiling of the Dio services (Dio_GetProfile),
+ * the host tests also build the drivers with it on */
+#ifndef DIO_PROFILING_API
+#define DIO_PROFILING_API                   (STD_OFF)
+#endif
+
+/* Pre-compile option for presence of the GPIO edge capture ring (Dio_Capture.c) */
+#define DIO_CAPTURE_API                     (STD_ON)
+
+/* Number of events held by the capture ring, shall be a power of two (at most 256) */
+#define DIO_CAPTURE_RING_SIZE               (16U)
+
+/* Pre-compile option for presence of the Dio pattern player (Dio_Pattern.c) */
+#define DIO_PATTERN_PLAYER_API              (STD_ON)
+
+/* Pre-compile option to let the pattern player own SysTick and its SysTick_Handler,
+ * when STD_OFF Dio_PatternTick shall be called by the application time base */
+#define DIO_PATTERN_USE_SYSTICK             (STD_ON)
+
+/* Channel access methods */
+#define DIO_CHANNEL_ACCESS_RMW              (0U) /* read-modify-write on GPIODATA (offset 0x3FC) */
+#define DIO_CHANNEL_ACCESS_MASKED           (1U) /* single store through the GPIODATA masked alias */
+#define DIO_CHANNEL_ACCESS_BITBAND          (2U) /* single load/store through the Cortex-M4 bit-band alias */
+
+/*
+ * Pre-compile option for the method used by the channel services to access GPIODATA,
+ * the host tests build the drivers with each method to compare them.
+ * MASKED is the default: a write is one store like BITBAND and half the accesses of RMW,
+ * and the Cortex-M4 turns a bit-band store into a locked read-modify-write of the
+ * GPIODATA word on the bus, which a masked alias store never needs.
+ */
+#ifndef DIO_CHANNEL_ACCESS_MODE
+#define DIO_CHANNEL_ACCESS_MODE             (DIO_CHANNEL_ACCESS_MASKED)
+#endif
+
+/*
+ * GPIO ports accessed through the AHB aperture:
+ * bit n set --> port n (0 --> PORTA ... 5 --> PORTF) uses AHB, cleared --> legacy APB.
+ * The aperture is selected in GPIOHBCTL by Port_Init, so the mask is the one of Port_Cfg.h.
+ */
+#include "Port_Cfg.h"
+#define DIO_GPIO_AHB_PORTS_MASK             (PORT_GPIO_AHB_PORTS_MASK)
+
+/*
+ * Configured Dio Channels, one X(NAME, PORT_NUM, CHANNEL_NUM) per channel in Dio_PBcfg.c order.
+ * The list generates the DioConf_<NAME>_CHANNEL_ID_INDEX values, the Channels rows of Dio_PBcfg.c
+ * and, without development error detection, the Dio_Write_<NAME>/Dio_Read_<NAME> accessors of Dio.h.
+ */
+#define DIO_CFG_CHANNELS(X) \
+  X(LED1, 5U, 1U) /* Pin 1 in PORTF */ \
+  X(SW1,  5U, 4U) /* Pin 4 in PORTF */
+
 /* Number of the configured Dio Channels */
-#define DIO_CONFIGURED_CHANNLES              (2U)
+#define DIO_CFG_CHANNEL_COUNT(NAME, PORT_NUM, CH_NUM)        + 1U
+#define DIO_CONFIGURED_CHANNLES              (0U DIO_CFG_CHANNELS(DIO_CFG_CHANNEL_COUNT))
+
+/* Number of the configured Dio Ports */
+#define DIO_CONFIGURED_PORTS                 (1U)
+
+/* Number of the configured Dio Channel Groups */
+#define DIO_CONFIGURED_CHANNEL_GROUPS        (1U)
+
+/* Channel Index in the array of structures in Dio_PBcfg.c: DioConf_<NAME>_CHANNEL_ID_INDEX */
+#define DIO_CFG_CHANNEL_ID_INDEX(NAME, PORT_NUM, CH_NUM)     DioConf_##NAME##_CHANNEL_ID_INDEX,
+enum
+{
+  DIO_CFG_CHANNELS(DIO_CFG_CHANNEL_ID_INDEX)
+};
+
+/* Port Index in the array of structures in Dio_PBcfg.c */
+#define DioConf_PORTF_PORT_ID_INDEX          (uint8)0x00
+
+/* DIO Configured Ports */
+#define DioConf_PORTF_PORT_NUM               (Dio_PortType)5 /* PORTF */
 
-/* Channel Index in the array of structures in Dio_PBcfg.c */
-#define DioConf_LED1_CHANNEL_ID_INDEX        (uint8)0x00
-#define DioConf_SW1_CHANNEL_ID_INDEX         (uint8)0x01
+/* Channel Group Index in the array of structures in Dio_PBcfg.c */
+#define DioConf_RGB_LED_GROUP_ID_INDEX       (uint8)0x00
 
-/* DIO Configured Port ID's  */
-#define DioConf_LED1_PORT_NUM                (Dio_PortType)5 /* PORTF */
-#define DioConf_SW1_PORT_NUM                 (Dio_PortType)5 /* PORTF */
+/* DIO Configured Channel Groups: RGB LED on PF1, PF2 and PF3 */
+#define DioConf_RGB_LED_GROUP_MASK           (uint8)0x0E
+#define DioConf_RGB_LED_GROUP_OFFSET         (uint8)1
+#define DioConf_RGB_LED_GROUP_PORT_INDEX     DioConf_PORTF_PORT_ID_INDEX
 
-/* DIO Configured Channel ID's */
-#define DioConf_LED1_CHANNEL_NUM             (Dio_ChannelType)1 /* Pin 1 in PORTF */
-#define DioConf_SW1_CHANNEL_NUM              (Dio_ChannelType)4 /* Pin 4 in PORTF */
+/* Channel Group references to be passed to Dio_ReadChannelGroup/Dio_WriteChannelGroup */
+#define DioConf_RGB_LED_GROUP_PTR            (&Dio_Configuration.Groups[DioConf_RGB_LED_GROUP_ID_INDEX])
 
 #endif /* DIO_CFG_H */
@@ -39,8 +39,21 @@
   #error "The SW version of PBcfg.c does not match the expected version"
 #endif
 
+/* Row of the Channels table generated from DIO_CFG_CHANNELS of Dio_Cfg.h */
+#define DIO_PBCFG_CHANNEL(NAME, PORT_NUM, CH_NUM)   {(Dio_PortType)(PORT_NUM),(Dio_ChannelType)(CH_NUM)},
+
 /* PB structure used with Dio_Init API */
 const Dio_ConfigType Dio_Configuration = {
-                                             DioConf_LED1_PORT_NUM,DioConf_LED1_CHANNEL_NUM,
-				             DioConf_SW1_PORT_NUM,DioConf_SW1_CHANNEL_NUM
+                                             /* Channels */
+                                             {
+                                               DIO_CFG_CHANNELS(DIO_PBCFG_CHANNEL)
+                                             },
+                                             /* Ports */
+                                             {
+                                               {DioConf_PORTF_PORT_NUM}
+                                             },
+                                             /* Channel Groups */
+                                             {
+                                               {DioConf_RGB_LED_GROUP_MASK,DioConf_RGB_LED_GROUP_OFFSET,DioConf_RGB_LED_GROUP_PORT_INDEX}
+                                             }
 				         };
\ No newline at end of file
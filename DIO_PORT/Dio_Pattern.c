@@ -0,0 +1,287 @@
+ /******************************************************************************
+ *
+ * Module: Dio
+ *
+ * File Name: Dio_Pattern.c
+ *
+ * Description: Source file for TM4C123GH6PM Microcontroller - Dio Pattern Player.
+ *              Streams buffers of port values to a GPIO port from the SysTick ISR.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Dio_Pattern.h"
+#include "Dio_Regs.h"
+
+#if (DIO_PATTERN_PLAYER_API == STD_ON)
+
+#if (DIO_PATTERN_USE_SYSTICK == STD_ON)
+#include "tm4c123gh6pm_registers.h"
+#endif
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Dio Modules */
+#if ((DET_AR_MAJOR_VERSION != DIO_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != DIO_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != DIO_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+/* Address of the masked alias of the GPIODATA register driven by the player, resolved by Dio_PatternStart */
+STATIC uint32 Dio_PatternAddress = 0U;
+
+/* Pattern buffers, shared between the application and the tick ISR */
+STATIC volatile Dio_PatternBufferType Dio_PatternBuffers[DIO_PATTERN_BUFFERS];
+
+/* Buffer being played by the ISR and position of the next value in it */
+STATIC volatile uint8 Dio_PatternPlaying = 0U;
+STATIC volatile uint16 Dio_PatternPosition = 0U;
+
+/* Buffer to be filled by the next Dio_PatternQueue call */
+STATIC uint8 Dio_PatternNextQueue = 0U;
+
+/* Player state and number of ticks without a queued value */
+STATIC volatile uint8 Dio_PatternState = DIO_PATTERN_IDLE;
+STATIC volatile uint32 Dio_PatternUnderruns = 0U;
+
+/************************************************************************************
+* Service Name: Dio_PatternStart
+* Service ID[hex]: 0x30
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): PortId - ID of DIO Port.
+*                  Mask - Channels of the port driven by the pattern.
+*                  TickPeriod - Time between two values in system clock cycles (1 --> 0x1000000).
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start the pattern player, the queued buffers are discarded.
+************************************************************************************/
+void Dio_PatternStart(Dio_PortType PortId, Dio_PortLevelType Mask, uint32 TickPeriod)
+{
+	/* Port table filled by Dio_Init from its configuration, 0 before Dio_Init */
+	uint32 Base = Dio_GetPortBaseAddress(PortId);
+	boolean error = FALSE;
+	uint8 Index;
+
+	/* Check if the used port is within the valid range */
+	if (DIO_CONFIGURED_PORTS <= PortId)
+	{
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_PATTERN_START_SID, DIO_E_PARAM_INVALID_PORT_ID);
+#endif
+		error = TRUE;
+	}
+	/* Check if the Driver is initialized before using this function */
+	else if (0U == Base)
+	{
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_PATTERN_START_SID, DIO_E_UNINIT);
+#endif
+		error = TRUE;
+	}
+	/* Check if SysTick can generate the tick period */
+	else if ((0U == TickPeriod) || (DIO_PATTERN_MAX_TICK_PERIOD < TickPeriod))
+	{
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_PATTERN_START_SID, DIO_E_PARAM_TICK_PERIOD);
+#endif
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	/* In-case there are no errors */
+	if (FALSE == error)
+	{
+		Dio_PatternStop();
+
+		/* Each tick is one store to the masked alias, the port bits outside Mask are never touched */
+		Dio_PatternAddress = DIO_GPIO_DATA_MASKED_ADDRESS(Base, Mask);
+
+		for (Index = 0U; Index < DIO_PATTERN_BUFFERS; Index++)
+		{
+			Dio_PatternBuffers[Index].Full = FALSE;
+		}
+		Dio_PatternPlaying   = 0U;
+		Dio_PatternPosition  = 0U;
+		Dio_PatternNextQueue = 0U;
+		Dio_PatternUnderruns = 0U;
+		Dio_PatternState     = DIO_PATTERN_PLAYING;
+
+#if (DIO_PATTERN_USE_SYSTICK == STD_ON)
+		/* Generate one SysTick interrupt every TickPeriod cycles */
+		MMIO_WRITE32(SYSTICK_RELOAD_ADDRESS, TickPeriod - 1U);
+		MMIO_WRITE32(SYSTICK_CURRENT_ADDRESS, 0U);
+		MMIO_WRITE32(SYSTICK_CTRL_ADDRESS, DIO_PATTERN_SYSTICK_ENABLE);
+#endif
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_PatternQueue
+* Service ID[hex]: 0x31
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Values - Values to be written to the port, one per tick.
+*                  Length - Number of values.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK if queued, E_NOT_OK if both buffers are still in use or Length is 0.
+* Description: Function to queue a buffer behind the one being played. The buffer is owned by
+*              the player until it has been played, then the application may refill it.
+************************************************************************************/
+Std_ReturnType Dio_PatternQueue(const Dio_PortLevelType * Values, uint16 Length)
+{
+	Std_ReturnType ret = E_NOT_OK;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if input pointer is not Null pointer */
+	if (NULL_PTR == Values)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_PATTERN_QUEUE_SID, DIO_E_PARAM_POINTER);
+	}
+	else
+#endif
+	/* An empty buffer is rejected, the tick ISR always has a value to write in a queued buffer */
+	if (0U == Length)
+	{
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_PATTERN_QUEUE_SID, DIO_E_PARAM_LENGTH);
+#endif
+	}
+	else if (FALSE == Dio_PatternBuffers[Dio_PatternNextQueue].Full)
+	{
+		/* Fill the buffer first, the ISR only looks at it once Full is set */
+		Dio_PatternBuffers[Dio_PatternNextQueue].Values = Values;
+		Dio_PatternBuffers[Dio_PatternNextQueue].Length = Length;
+		Dio_PatternBuffers[Dio_PatternNextQueue].Full   = TRUE;
+		Dio_PatternNextQueue = (uint8)((Dio_PatternNextQueue + 1U) % DIO_PATTERN_BUFFERS);
+		ret = E_OK;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return ret;
+}
+
+/************************************************************************************
+* Service Name: Dio_PatternStop
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop the pattern player, the port keeps the last written value.
+************************************************************************************/
+void Dio_PatternStop(void)
+{
+#if (DIO_PATTERN_USE_SYSTICK == STD_ON)
+	MMIO_WRITE32(SYSTICK_CTRL_ADDRESS, 0U);
+#endif
+	Dio_PatternState = DIO_PATTERN_IDLE;
+}
+
+/************************************************************************************
+* Service Name: Dio_PatternGetState
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint8 - DIO_PATTERN_PLAYING or DIO_PATTERN_IDLE.
+* Description: Function to return the pattern player state.
+************************************************************************************/
+uint8 Dio_PatternGetState(void)
+{
+	return Dio_PatternState;
+}
+
+/************************************************************************************
+* Service Name: Dio_PatternGetUnderruns
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of ticks without a queued value since Dio_PatternStart.
+* Description: Function to return the number of pattern underruns.
+************************************************************************************/
+uint32 Dio_PatternGetUnderruns(void)
+{
+	return Dio_PatternUnderruns;
+}
+
+/************************************************************************************
+* Service Name: Dio_PatternTick
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to output the next value of the pattern, called once per tick period.
+*              Its cost is bounded (one store plus the buffer bookkeeping) so the output
+*              jitter is the interrupt latency only.
+************************************************************************************/
+void Dio_PatternTick(void)
+{
+	if (DIO_PATTERN_PLAYING == Dio_PatternState)
+	{
+		volatile Dio_PatternBufferType * Buffer = &Dio_PatternBuffers[Dio_PatternPlaying];
+
+		if (TRUE == Buffer->Full)
+		{
+			MMIO_WRITE32(Dio_PatternAddress, Buffer->Values[Dio_PatternPosition]);
+			Dio_PatternPosition++;
+
+			if (Dio_PatternPosition >= Buffer->Length)
+			{
+				/* Give the buffer back to the application and continue with the next one */
+				Buffer->Full = FALSE;
+				Dio_PatternPosition = 0U;
+				Dio_PatternPlaying  = (uint8)((Dio_PatternPlaying + 1U) % DIO_PATTERN_BUFFERS);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+		else
+		{
+			/* Nothing queued, the port keeps its last value */
+			Dio_PatternUnderruns++;
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+#if (DIO_PATTERN_USE_SYSTICK == STD_ON)
+/* SysTick ISR, overrides the weak handler of cstartup_M.c */
+void SysTick_Handler(void)
+{
+	Dio_PatternTick();
+}
+#endif
+
+#endif /* (DIO_PATTERN_PLAYER_API == STD_ON) */
@@ -0,0 +1,91 @@
+ /******************************************************************************
+ *
+ * Module: Dio
+ *
+ * File Name: Dio_Pattern.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Dio Pattern Player.
+ *              Streams buffers of port values to a GPIO port from the SysTick ISR.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef DIO_PATTERN_H
+#define DIO_PATTERN_H
+
+#include "Dio.h"
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for DIO pattern start (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_PATTERN_START_SID          (uint8)0x30
+
+/* Service ID for DIO pattern queue buffer (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_PATTERN_QUEUE_SID          (uint8)0x31
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/*
+ * Dio_PatternStart API service called with a tick period SysTick can not generate
+ * (Not exist in AUTOSAR 4.0.3 DIO SWS Document).
+ */
+#define DIO_E_PARAM_TICK_PERIOD        (uint8)0xF2
+
+/*******************************************************************************
+ *                              Module Definitions                             *
+ *******************************************************************************/
+
+/* Number of pattern buffers, one is played while the application refills the other */
+#define DIO_PATTERN_BUFFERS            (2U)
+
+/* Longest tick period in system clock cycles, SysTick reloads a 24-bit value (period - 1) */
+#define DIO_PATTERN_MAX_TICK_PERIOD    (0x1000000U)
+
+/* SysTick control bits: counter enable, interrupt enable and system clock source */
+#define DIO_PATTERN_SYSTICK_ENABLE     (0x07U)
+
+/* Pattern player states */
+#define DIO_PATTERN_IDLE               (0U)
+#define DIO_PATTERN_PLAYING            (1U)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Pattern buffer slot shared between the application (producer) and the tick ISR (consumer) */
+typedef struct
+{
+	/* Values written to the port one per tick, only the bits of the player mask are driven */
+	const Dio_PortLevelType * Values;
+	/* Number of values in the buffer */
+	uint16 Length;
+	/* TRUE when queued by the application, cleared by the ISR once fully played */
+	boolean Full;
+}Dio_PatternBufferType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function to start the pattern player on a configured port, Mask selects the driven channels
+ * and TickPeriod is the time between two values in SysTick (system clock) cycles */
+void Dio_PatternStart(Dio_PortType PortId, Dio_PortLevelType Mask, uint32 TickPeriod);
+
+/* Function to queue a buffer of values, returns E_NOT_OK if both buffers are still in use */
+Std_ReturnType Dio_PatternQueue(const Dio_PortLevelType * Values, uint16 Length);
+
+/* Function to stop the pattern player, the port keeps the last written value */
+void Dio_PatternStop(void);
+
+/* Function to return DIO_PATTERN_PLAYING or DIO_PATTERN_IDLE */
+uint8 Dio_PatternGetState(void);
+
+/* Function to return the number of ticks where no queued value was available */
+uint32 Dio_PatternGetUnderruns(void);
+
+/* Function called once per tick period (from the SysTick ISR) to output the next value */
+void Dio_PatternTick(void);
+
+#endif /* DIO_PATTERN_H */
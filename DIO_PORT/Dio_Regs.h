@@ -14,11 +14,75 @@
 
 #include "Std_Types.h"
 
-#define GPIO_PORTA_DATA_REG       (*((volatile uint32 *)0x400043FC))
-#define GPIO_PORTB_DATA_REG       (*((volatile uint32 *)0x400053FC))
-#define GPIO_PORTC_DATA_REG       (*((volatile uint32 *)0x400063FC))
-#define GPIO_PORTD_DATA_REG       (*((volatile uint32 *)0x400073FC))
-#define GPIO_PORTE_DATA_REG       (*((volatile uint32 *)0x400243FC))
-#define GPIO_PORTF_DATA_REG       (*((volatile uint32 *)0x400253FC))
+/* Dio Pre-Compile Configuration Header file, selects the GPIO aperture of each port */
+#include "Dio_Cfg.h"
+
+/* Register access macros, volatile accesses on the target or the simulated register file on the host */
+#include "Mmio.h"
+
+/* GPIO Ports base addresses through the legacy APB aperture */
+#define DIO_GPIO_PORTA_APB_BASE_ADDRESS   (0x40004000U)
+#define DIO_GPIO_PORTB_APB_BASE_ADDRESS   (0x40005000U)
+#define DIO_GPIO_PORTC_APB_BASE_ADDRESS   (0x40006000U)
+#define DIO_GPIO_PORTD_APB_BASE_ADDRESS   (0x40007000U)
+#define DIO_GPIO_PORTE_APB_BASE_ADDRESS   (0x40024000U)
+#define DIO_GPIO_PORTF_APB_BASE_ADDRESS   (0x40025000U)
+
+/* GPIO Ports base addresses through the AHB aperture */
+#define DIO_GPIO_PORTA_AHB_BASE_ADDRESS   (0x40058000U)
+#define DIO_GPIO_PORTB_AHB_BASE_ADDRESS   (0x40059000U)
+#define DIO_GPIO_PORTC_AHB_BASE_ADDRESS   (0x4005A000U)
+#define DIO_GPIO_PORTD_AHB_BASE_ADDRESS   (0x4005B000U)
+#define DIO_GPIO_PORTE_AHB_BASE_ADDRESS   (0x4005C000U)
+#define DIO_GPIO_PORTF_AHB_BASE_ADDRESS   (0x4005D000U)
+
+/* Selects the AHB or the APB base address of port PORT_NUM according to DIO_GPIO_AHB_PORTS_MASK */
+#define DIO_GPIO_APERTURE(PORT_NUM,APB,AHB) \
+  ((DIO_GPIO_AHB_PORTS_MASK & (1U << (PORT_NUM))) ? (AHB) : (APB))
+
+/* GPIO Ports base addresses through the configured aperture */
+#define DIO_GPIO_PORTA_BASE_ADDRESS       DIO_GPIO_APERTURE(0U, DIO_GPIO_PORTA_APB_BASE_ADDRESS, DIO_GPIO_PORTA_AHB_BASE_ADDRESS)
+#define DIO_GPIO_PORTB_BASE_ADDRESS       DIO_GPIO_APERTURE(1U, DIO_GPIO_PORTB_APB_BASE_ADDRESS, DIO_GPIO_PORTB_AHB_BASE_ADDRESS)
+#define DIO_GPIO_PORTC_BASE_ADDRESS       DIO_GPIO_APERTURE(2U, DIO_GPIO_PORTC_APB_BASE_ADDRESS, DIO_GPIO_PORTC_AHB_BASE_ADDRESS)
+#define DIO_GPIO_PORTD_BASE_ADDRESS       DIO_GPIO_APERTURE(3U, DIO_GPIO_PORTD_APB_BASE_ADDRESS, DIO_GPIO_PORTD_AHB_BASE_ADDRESS)
+#define DIO_GPIO_PORTE_BASE_ADDRESS       DIO_GPIO_APERTURE(4U, DIO_GPIO_PORTE_APB_BASE_ADDRESS, DIO_GPIO_PORTE_AHB_BASE_ADDRESS)
+#define DIO_GPIO_PORTF_BASE_ADDRESS       DIO_GPIO_APERTURE(5U, DIO_GPIO_PORTF_APB_BASE_ADDRESS, DIO_GPIO_PORTF_AHB_BASE_ADDRESS)
+
+/* Base address of the port PORT_NUM (0 --> PORTA ... 5 --> PORTF), folds to a constant for a constant PORT_NUM */
+#define DIO_GPIO_PORT_BASE_ADDRESS(PORT_NUM) \
+  (((PORT_NUM) == 0U) ? DIO_GPIO_PORTA_BASE_ADDRESS : \
+   ((PORT_NUM) == 1U) ? DIO_GPIO_PORTB_BASE_ADDRESS : \
+   ((PORT_NUM) == 2U) ? DIO_GPIO_PORTC_BASE_ADDRESS : \
+   ((PORT_NUM) == 3U) ? DIO_GPIO_PORTD_BASE_ADDRESS : \
+   ((PORT_NUM) == 4U) ? DIO_GPIO_PORTE_BASE_ADDRESS : \
+                        DIO_GPIO_PORTF_BASE_ADDRESS)
+
+/*
+ * GPIODATA address-mask aperture: address bits [9:2] select the DATA bits affected by
+ * the access, so base + (MASK << 2) reads/writes only the bits set in MASK.
+ * MASK = 0xFF gives the full DATA register at offset 0x3FC.
+ */
+#define DIO_GPIO_DATA_MASKED_OFFSET(MASK) ((uint32)(MASK) << 2)
+
+/* Address of the GPIODATA register of the port at BASE seen through the aperture of MASK */
+#define DIO_GPIO_DATA_MASKED_ADDRESS(BASE,MASK) ((BASE) + DIO_GPIO_DATA_MASKED_OFFSET(MASK))
+
+/* Mask selecting all the 8 bits of a GPIO port */
+#define DIO_GPIO_ALL_PINS_MASK            (0xFFU)
+
+/* Addresses of the GPIO masked interrupt status and interrupt clear registers of the port at BASE */
+#define DIO_GPIO_MIS_ADDRESS(BASE)        ((BASE) + 0x418U)
+#define DIO_GPIO_ICR_ADDRESS(BASE)        ((BASE) + 0x41CU)
+
+/*
+ * Cortex-M4 peripheral bit-band region: each bit of the 1MB peripheral region at
+ * 0x40000000 has its own word in the alias region at 0x42000000.
+ */
+#define DIO_PERIPHERAL_BASE_ADDRESS          (0x40000000U)
+#define DIO_PERIPHERAL_BITBAND_BASE_ADDRESS  (0x42000000U)
+
+/* Bit-band alias word address of bit BIT of the peripheral register at ADDR */
+#define DIO_BITBAND_ALIAS_ADDRESS(ADDR,BIT) \
+  (DIO_PERIPHERAL_BITBAND_BASE_ADDRESS + (((uint32)(ADDR) - DIO_PERIPHERAL_BASE_ADDRESS) << 5) + ((uint32)(BIT) << 2))
 
 #endif /* DIO_REGS_H */
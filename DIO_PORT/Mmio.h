@@ -0,0 +1,47 @@
+ /******************************************************************************
+ *
+ * Module: Common - MMIO
+ *
+ * File Name: Mmio.h
+ *
+ * Description: Memory mapped register access used by all the drivers. On the target
+ *              each access is a volatile load/store, with MMIO_SIMULATION defined
+ *              (host build) it goes through the simulated register file of Mmio_Sim.c.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef MMIO_H
+#define MMIO_H
+
+#include "Std_Types.h"
+
+#ifdef MMIO_SIMULATION
+
+#include "Mmio_Sim.h"
+
+/* Read the 32-bit register at ADDRESS */
+#define MMIO_READ32(ADDRESS)            Mmio_SimRead32((uint32)(ADDRESS))
+
+/* Write VALUE to the 32-bit register at ADDRESS */
+#define MMIO_WRITE32(ADDRESS,VALUE)     Mmio_SimWrite32((uint32)(ADDRESS), (uint32)(VALUE))
+
+#else
+
+/* Read the 32-bit register at ADDRESS */
+#define MMIO_READ32(ADDRESS)            (*((volatile uint32 *)(ADDRESS)))
+
+/* Write VALUE to the 32-bit register at ADDRESS */
+#define MMIO_WRITE32(ADDRESS,VALUE)     (*((volatile uint32 *)(ADDRESS)) = (uint32)(VALUE))
+
+#endif
+
+/* Read-modify-write helpers, one read and one write of the register at ADDRESS */
+#define MMIO_SET_BITS32(ADDRESS,MASK)   MMIO_WRITE32((ADDRESS), MMIO_READ32(ADDRESS) | (uint32)(MASK))
+#define MMIO_CLEAR_BITS32(ADDRESS,MASK) MMIO_WRITE32((ADDRESS), MMIO_READ32(ADDRESS) & ~(uint32)(MASK))
+
+/* Set/Clear bit BIT of the register at ADDRESS */
+#define MMIO_SET_BIT32(ADDRESS,BIT)     MMIO_SET_BITS32((ADDRESS), ((uint32)1U << (BIT)))
+#define MMIO_CLEAR_BIT32(ADDRESS,BIT)   MMIO_CLEAR_BITS32((ADDRESS), ((uint32)1U << (BIT)))
+
+#endif /* MMIO_H */
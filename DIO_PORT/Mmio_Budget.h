@@ -0,0 +1,127 @@
+ /******************************************************************************
+ *
+ * Module: Common - MMIO
+ *
+ * File Name: Mmio_Budget.h
+ *
+ * Description: Register access budgets of the Dio and Port services, checked on the
+ *              host build against the counters of the simulated register file.
+ *
+ *              Each budget is {Reads, Writes, BusCycles} of one call, recorded from
+ *              Mmio_Sim.c with the configuration checked in (Port_Configuration,
+ *              Dio_Configuration, Dio_Cfg.h and Port_Cfg.h, all ports on AHB) and the
+ *              call sequence below, each call starting from the state the previous ones
+ *              left. Test/Test_Budget.c runs the sequence on the host build, clears the
+ *              counters before each call and fails if Mmio_SimCheckBudget reports an
+ *              overrun. Any fault also fails the check.
+ *
+ *              A change which makes a service cheaper lowers its budget in the same
+ *              change, a change which needs a higher budget has to say why.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef MMIO_BUDGET_H
+#define MMIO_BUDGET_H
+
+#include "Mmio_Sim.h"
+
+/*******************************************************************************
+ *                              Port Services                                  *
+ *******************************************************************************/
+
+/* Port_Init(&Port_Configuration) after Mmio_SimReset, read-modify-write for PC (JTAG pins) only */
+#define MMIO_BUDGET_PORT_INIT                      {12U, 49U, 66U}
+
+/* Port_RefreshPortDirection(), one GPIODIR store per port, read-modify-write for PC (JTAG pins) only */
+#define MMIO_BUDGET_PORT_REFRESH_PORT_DIRECTION    {1U, 6U, 7U}
+
+/* Port_SetPinDirection(PORTF_PF1, PORT_PIN_OUT), rejected: PF1 direction is not changeable in Port_Configuration */
+#define MMIO_BUDGET_PORT_SET_PIN_DIRECTION         {0U, 0U, 0U}
+
+/* Port_SwitchPinMuxSet(PortConf_UART0_PIN_MUX_SET_ID) from the default pin-mux set, GPIOPCTL and GPIOAFSEL of PA */
+#define MMIO_BUDGET_PORT_SWITCH_PIN_MUX_SET        {2U, 2U, 4U}
+
+/* Port_SetPinMode(PORTA_PA0, PORT_DIO_MODE) in the UART0 pin-mux set, where PA0 mode is changeable */
+#define MMIO_BUDGET_PORT_SET_PIN_MODE              {4U, 4U, 8U}
+
+/* Port_SetPinDirections({PORTA_PA0, PORTA_PA1}, {PORT_PIN_IN, PORT_PIN_OUT}, 2) in the UART0 pin-mux set */
+#define MMIO_BUDGET_PORT_SET_PIN_DIRECTIONS        {1U, 1U, 2U}
+
+/* Port_SetPinModes({PORTA_PA0, PORTA_PA1}, {PORT_ALTERNATE_FUNCTION_UART_MODE x 2}, 2) after PA0 was set to DIO */
+#define MMIO_BUDGET_PORT_SET_PIN_MODES             {4U, 4U, 8U}
+
+/*******************************************************************************
+ *                              Dio Services                                   *
+ *******************************************************************************/
+
+/* Dio_Init(&Dio_Configuration) */
+#define MMIO_BUDGET_DIO_INIT                       {0U, 0U, 0U}
+
+/* Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH) */
+#define MMIO_BUDGET_DIO_WRITE_CHANNEL              {0U, 1U, 1U}
+
+/* Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX) */
+#define MMIO_BUDGET_DIO_READ_CHANNEL               {1U, 0U, 1U}
+
+/* Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX) */
+#define MMIO_BUDGET_DIO_FLIP_CHANNEL               {1U, 1U, 2U}
+
+/* Dio_ReadPort(DioConf_PORTF_PORT_ID_INDEX) */
+#define MMIO_BUDGET_DIO_READ_PORT                  {1U, 0U, 1U}
+
+/* Dio_WritePort(DioConf_PORTF_PORT_ID_INDEX, 0x0F) */
+#define MMIO_BUDGET_DIO_WRITE_PORT                 {0U, 1U, 1U}
+
+/* Dio_MaskedWritePort(DioConf_PORTF_PORT_ID_INDEX, 0x0F, 0x0E) */
+#define MMIO_BUDGET_DIO_MASKED_WRITE_PORT          {0U, 1U, 1U}
+
+/* Dio_ReadChannelGroup(DioConf_RGB_LED_GROUP_PTR) */
+#define MMIO_BUDGET_DIO_READ_CHANNEL_GROUP         {1U, 0U, 1U}
+
+/* Dio_WriteChannelGroup(DioConf_RGB_LED_GROUP_PTR, 5) */
+#define MMIO_BUDGET_DIO_WRITE_CHANNEL_GROUP        {0U, 1U, 1U}
+
+/* Dio_WriteChannels({LED1, SW1}, {STD_HIGH, STD_LOW}, 2) */
+#define MMIO_BUDGET_DIO_WRITE_CHANNELS             {0U, 1U, 1U}
+
+/* Dio_ReadChannels({LED1, SW1}, 2) */
+#define MMIO_BUDGET_DIO_READ_CHANNELS              {1U, 0U, 1U}
+
+/* Dio_BeginUpdate() */
+#define MMIO_BUDGET_DIO_BEGIN_UPDATE               {0U, 0U, 0U}
+
+/* Dio_StageChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_LOW), only the shadow image is written */
+#define MMIO_BUDGET_DIO_STAGE_CHANNEL              {0U, 0U, 0U}
+
+/* Dio_Commit() after Dio_StageChannel(LED1, STD_LOW) */
+#define MMIO_BUDGET_DIO_COMMIT                     {0U, 1U, 1U}
+
+/* Dio_DebounceMainFunction() */
+#define MMIO_BUDGET_DIO_DEBOUNCE_MAIN_FUNCTION     {1U, 0U, 1U}
+
+/* Dio_ReadDebouncedChannel(DioConf_SW1_CHANNEL_ID_INDEX) */
+#define MMIO_BUDGET_DIO_READ_DEBOUNCED_CHANNEL     {0U, 0U, 0U}
+
+/* Dio_GetDebouncedEdges(&Rising, &Falling) */
+#define MMIO_BUDGET_DIO_GET_DEBOUNCED_EDGES        {0U, 0U, 0U}
+
+/* Dio_ReadAllPorts(&Snapshot) */
+#define MMIO_BUDGET_DIO_READ_ALL_PORTS             {1U, 0U, 1U}
+
+/* Dio_PatternStart(DioConf_PORTF_PORT_ID_INDEX, 0x0E, 1000) */
+#define MMIO_BUDGET_DIO_PATTERN_START              {0U, 4U, 4U}
+
+/* Dio_PatternTick() with a queued buffer */
+#define MMIO_BUDGET_DIO_PATTERN_TICK               {0U, 1U, 1U}
+
+/* Dio_PatternStop() */
+#define MMIO_BUDGET_DIO_PATTERN_STOP               {0U, 1U, 1U}
+
+/* Dio_CaptureInit() */
+#define MMIO_BUDGET_DIO_CAPTURE_INIT               {0U, 0U, 0U}
+
+/* Dio_CaptureIsr(5), PORTF */
+#define MMIO_BUDGET_DIO_CAPTURE_ISR                {2U, 1U, 3U}
+
+#endif /* MMIO_BUDGET_H */
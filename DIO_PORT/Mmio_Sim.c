@@ -0,0 +1,548 @@
+ /******************************************************************************
+ *
+ * Module: Common - MMIO
+ *
+ * File Name: Mmio_Sim.c
+ *
+ * Description: Simulated TM4C123GH6PM register file used by the host build of the
+ *              Dio and Port drivers, see Mmio_Sim.h.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Mmio_Sim.h"
+
+/*******************************************************************************
+ *                              Module Definitions                             *
+ *******************************************************************************/
+
+/* System control registers */
+#define MMIO_SIM_SYSCTL_PAGE            (0x400FE000U)
+#define MMIO_SIM_GPIOHBCTL_OFFSET       (0x06CU)
+#define MMIO_SIM_RCGC2_OFFSET           (0x108U)
+#define MMIO_SIM_RCGCGPIO_OFFSET        (0x608U)
+#define MMIO_SIM_PRGPIO_OFFSET          (0xA08U)
+
+/* GPIO AHB aperture, port n is at base + (n << 12) */
+#define MMIO_SIM_GPIO_AHB_BASE          (0x40058000U)
+
+/* GPIO registers offsets */
+#define MMIO_SIM_GPIO_DATA_END          (0x400U)
+#define MMIO_SIM_GPIO_DIR               (0x400U)
+#define MMIO_SIM_GPIO_IS                (0x404U)
+#define MMIO_SIM_GPIO_IBE               (0x408U)
+#define MMIO_SIM_GPIO_IEV               (0x40CU)
+#define MMIO_SIM_GPIO_IM                (0x410U)
+#define MMIO_SIM_GPIO_RIS               (0x414U)
+#define MMIO_SIM_GPIO_MIS               (0x418U)
+#define MMIO_SIM_GPIO_ICR               (0x41CU)
+#define MMIO_SIM_GPIO_AFSEL             (0x420U)
+#define MMIO_SIM_GPIO_PUR               (0x510U)
+#define MMIO_SIM_GPIO_PDR               (0x514U)
+#define MMIO_SIM_GPIO_DEN               (0x51CU)
+#define MMIO_SIM_GPIO_LOCK              (0x520U)
+#define MMIO_SIM_GPIO_CR                (0x524U)
+#define MMIO_SIM_GPIO_AMSEL             (0x528U)
+#define MMIO_SIM_GPIO_PCTL              (0x52CU)
+
+/* Value written to GPIOLOCK to unlock GPIOCR */
+#define MMIO_SIM_GPIO_UNLOCK_VALUE      (0x4C4F434BU)
+
+/* Peripheral bit-band region and its alias */
+#define MMIO_SIM_PERIPHERAL_BASE        (0x40000000U)
+#define MMIO_SIM_BITBAND_BASE           (0x42000000U)
+#define MMIO_SIM_BITBAND_END            (0x44000000U)
+
+/* Private peripheral bus, the DWT block and DEMCR are instrumentation and not counted */
+#define MMIO_SIM_PPB_BASE               (0xE0000000U)
+#define MMIO_SIM_DWT_PAGE               (0xE0001000U)
+#define MMIO_SIM_DWT_CYCCNT             (0xE0001004U)
+#define MMIO_SIM_DEMCR                  (0xE000EDFCU)
+#define MMIO_SIM_NVIC_EN0               (0xE000E100U)
+
+/* Number of core registers the plain store can hold */
+#define MMIO_SIM_CORE_REGISTERS         (16U)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Registers of one simulated GPIO port */
+typedef struct
+{
+	uint32 Out;
+	uint32 In;
+	uint32 Dir;
+	uint32 Is;
+	uint32 Ibe;
+	uint32 Iev;
+	uint32 Im;
+	uint32 Ris;
+	uint32 Afsel;
+	uint32 Pur;
+	uint32 Pdr;
+	uint32 Den;
+	uint32 Cr;
+	uint32 Amsel;
+	uint32 Pctl;
+	boolean Locked;
+}Mmio_SimGpioType;
+
+/* One core register of the plain store */
+typedef struct
+{
+	uint32 Address;
+	uint32 Value;
+}Mmio_SimCoreRegisterType;
+
+/*******************************************************************************
+ *                              Module Variables                               *
+ *******************************************************************************/
+
+STATIC Mmio_SimGpioType Mmio_SimGpio[MMIO_SIM_GPIO_PORTS];
+
+/* APB base address of each port, the APB map is not contiguous */
+STATIC const uint32 Mmio_SimApbBase[MMIO_SIM_GPIO_PORTS] =
+{
+	0x40004000U, 0x40005000U, 0x40006000U, 0x40007000U, 0x40024000U, 0x40025000U
+};
+
+/* GPIOCR reset value of each port: PC0-PC3 (JTAG), PD7 and PF0 (NMI) are committed as locked */
+STATIC const uint32 Mmio_SimCrReset[MMIO_SIM_GPIO_PORTS] =
+{
+	0xFFU, 0xFFU, 0xF0U, 0x7FU, 0xFFU, 0xFEU
+};
+
+STATIC uint32 Mmio_SimRcgcGpio = 0U;
+STATIC uint32 Mmio_SimPrGpio = 0U;
+STATIC uint32 Mmio_SimHbctl = 0U;
+
+/* Bus accesses left before each clocked port reports ready, 0 once ready or while not clocked */
+STATIC uint32 Mmio_SimReadyCountdown[MMIO_SIM_GPIO_PORTS];
+
+/* Ports which never report ready in PRGPIO, set by Mmio_SimStallClocks */
+STATIC uint32 Mmio_SimStalledPorts = 0U;
+
+STATIC Mmio_SimCoreRegisterType Mmio_SimCore[MMIO_SIM_CORE_REGISTERS];
+STATIC uint8 Mmio_SimCoreUsed = 0U;
+
+STATIC Mmio_SimCountersType Mmio_SimCounters;
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+/* Pad level of a port: output latch on the outputs and external level on the inputs */
+STATIC uint32 Mmio_SimPadLevels(const Mmio_SimGpioType * Gpio)
+{
+	return ((Gpio->Dir & Gpio->Out) | (~Gpio->Dir & Gpio->In)) & 0xFFU;
+}
+
+/* Latch in RIS the edges between the pad levels Old and New on the edge sensitive pins */
+STATIC void Mmio_SimLatchEdges(Mmio_SimGpioType * Gpio, uint32 Old, uint32 New)
+{
+	uint32 Rising  = (Old ^ New) & New;
+	uint32 Falling = (Old ^ New) & Old;
+
+	Gpio->Ris |= ((Rising & (Gpio->Ibe | Gpio->Iev)) | (Falling & (Gpio->Ibe | ~Gpio->Iev))) & ~Gpio->Is & 0xFFU;
+}
+
+/* Advance the clock ready countdown of every port by one bus access */
+STATIC void Mmio_SimTick(void)
+{
+	uint8 PortNum;
+
+	for (PortNum = 0U; PortNum < MMIO_SIM_GPIO_PORTS; PortNum++)
+	{
+		if ((Mmio_SimReadyCountdown[PortNum] > 0U) && !(Mmio_SimStalledPorts & (1U << PortNum)))
+		{
+			Mmio_SimReadyCountdown[PortNum]--;
+			if (0U == Mmio_SimReadyCountdown[PortNum])
+			{
+				Mmio_SimPrGpio |= (1U << PortNum);
+			}
+		}
+	}
+}
+
+/* Update the GPIO clock gates, RCGC2 and RCGCGPIO are two views of the same gates */
+STATIC void Mmio_SimSetClocks(uint32 Value)
+{
+	uint8 PortNum;
+
+	Value &= 0x3FU;
+	for (PortNum = 0U; PortNum < MMIO_SIM_GPIO_PORTS; PortNum++)
+	{
+		uint32 Bit = (1U << PortNum);
+
+		if ((Value & Bit) && !(Mmio_SimRcgcGpio & Bit))
+		{
+			Mmio_SimReadyCountdown[PortNum] = MMIO_SIM_CLOCK_READY_ACCESSES;
+		}
+		else if (!(Value & Bit))
+		{
+			Mmio_SimReadyCountdown[PortNum] = 0U;
+			Mmio_SimPrGpio &= ~Bit;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	Mmio_SimRcgcGpio = Value;
+}
+
+/* Find the port and the register offset of Address, returns FALSE outside the GPIO apertures */
+STATIC boolean Mmio_SimDecodeGpio(uint32 Address, uint8 * PortNum, uint32 * Offset, boolean * Ahb)
+{
+	uint32 Page = Address & ~0xFFFU;
+	uint8 Index;
+
+	for (Index = 0U; Index < MMIO_SIM_GPIO_PORTS; Index++)
+	{
+		if (Page == Mmio_SimApbBase[Index])
+		{
+			*Ahb = FALSE;
+			break;
+		}
+		if (Page == (MMIO_SIM_GPIO_AHB_BASE + ((uint32)Index << 12)))
+		{
+			*Ahb = TRUE;
+			break;
+		}
+	}
+	*PortNum = Index;
+	*Offset  = Address & 0xFFFU;
+	return (Index < MMIO_SIM_GPIO_PORTS) ? TRUE : FALSE;
+}
+
+/* Return the core register of the plain store at Address, allocating it on first use */
+STATIC Mmio_SimCoreRegisterType * Mmio_SimCoreRegister(uint32 Address)
+{
+	uint8 Index;
+
+	for (Index = 0U; Index < Mmio_SimCoreUsed; Index++)
+	{
+		if (Mmio_SimCore[Index].Address == Address)
+		{
+			return &Mmio_SimCore[Index];
+		}
+	}
+	if (Mmio_SimCoreUsed < MMIO_SIM_CORE_REGISTERS)
+	{
+		Mmio_SimCore[Mmio_SimCoreUsed].Address = Address;
+		Mmio_SimCore[Mmio_SimCoreUsed].Value   = 0U;
+		return &Mmio_SimCore[Mmio_SimCoreUsed++];
+	}
+	return NULL_PTR;
+}
+
+/* Read register Offset of a GPIO port */
+STATIC uint32 Mmio_SimGpioRead(const Mmio_SimGpioType * Gpio, uint32 Offset, boolean * Valid)
+{
+	*Valid = TRUE;
+	if (Offset < MMIO_SIM_GPIO_DATA_END)
+	{
+		/* Address bits [9:2] mask the DATA bits, the others read as zeros */
+		return Mmio_SimPadLevels(Gpio) & (Offset >> 2);
+	}
+	switch (Offset)
+	{
+		case MMIO_SIM_GPIO_DIR:   return Gpio->Dir;
+		case MMIO_SIM_GPIO_IS:    return Gpio->Is;
+		case MMIO_SIM_GPIO_IBE:   return Gpio->Ibe;
+		case MMIO_SIM_GPIO_IEV:   return Gpio->Iev;
+		case MMIO_SIM_GPIO_IM:    return Gpio->Im;
+		case MMIO_SIM_GPIO_RIS:   return Gpio->Ris;
+		case MMIO_SIM_GPIO_MIS:   return Gpio->Ris & Gpio->Im;
+		case MMIO_SIM_GPIO_ICR:   return 0U;
+		case MMIO_SIM_GPIO_AFSEL: return Gpio->Afsel;
+		case MMIO_SIM_GPIO_PUR:   return Gpio->Pur;
+		case MMIO_SIM_GPIO_PDR:   return Gpio->Pdr;
+		case MMIO_SIM_GPIO_DEN:   return Gpio->Den;
+		case MMIO_SIM_GPIO_LOCK:  return (TRUE == Gpio->Locked) ? 1U : 0U;
+		case MMIO_SIM_GPIO_CR:    return Gpio->Cr;
+		case MMIO_SIM_GPIO_AMSEL: return Gpio->Amsel;
+		case MMIO_SIM_GPIO_PCTL:  return Gpio->Pctl;
+		default:
+			*Valid = FALSE;
+			return 0U;
+	}
+}
+
+/* Write register Offset of a GPIO port */
+STATIC void Mmio_SimGpioWrite(Mmio_SimGpioType * Gpio, uint32 Offset, uint32 Value, boolean * Valid)
+{
+	uint32 OldPad = Mmio_SimPadLevels(Gpio);
+
+	*Valid = TRUE;
+	if (Offset < MMIO_SIM_GPIO_DATA_END)
+	{
+		uint32 Mask = Offset >> 2;
+		Gpio->Out = (Gpio->Out & ~Mask) | (Value & Mask);
+		Mmio_SimLatchEdges(Gpio, OldPad, Mmio_SimPadLevels(Gpio));
+		return;
+	}
+	Value &= (MMIO_SIM_GPIO_PCTL == Offset) || (MMIO_SIM_GPIO_LOCK == Offset) ? 0xFFFFFFFFU : 0xFFU;
+	switch (Offset)
+	{
+		case MMIO_SIM_GPIO_DIR:
+			Gpio->Dir = Value;
+			Mmio_SimLatchEdges(Gpio, OldPad, Mmio_SimPadLevels(Gpio));
+			break;
+		case MMIO_SIM_GPIO_IS:    Gpio->Is  = Value; break;
+		case MMIO_SIM_GPIO_IBE:   Gpio->Ibe = Value; break;
+		case MMIO_SIM_GPIO_IEV:   Gpio->Iev = Value; break;
+		case MMIO_SIM_GPIO_IM:    Gpio->Im  = Value; break;
+		case MMIO_SIM_GPIO_RIS:   break; /* Read only */
+		case MMIO_SIM_GPIO_MIS:   break; /* Read only */
+		case MMIO_SIM_GPIO_ICR:   Gpio->Ris &= ~Value; break;
+		/* Commit protected registers, only the bits set in GPIOCR change */
+		case MMIO_SIM_GPIO_AFSEL: Gpio->Afsel = (Gpio->Afsel & ~Gpio->Cr) | (Value & Gpio->Cr); break;
+		case MMIO_SIM_GPIO_DEN:   Gpio->Den   = (Gpio->Den & ~Gpio->Cr) | (Value & Gpio->Cr); break;
+		case MMIO_SIM_GPIO_PUR:
+			/* Setting a pull-up clears the pull-down of the same pin */
+			Gpio->Pur  = (Gpio->Pur & ~Gpio->Cr) | (Value & Gpio->Cr);
+			Gpio->Pdr &= ~(Value & Gpio->Cr);
+			break;
+		case MMIO_SIM_GPIO_PDR:
+			Gpio->Pdr  = (Gpio->Pdr & ~Gpio->Cr) | (Value & Gpio->Cr);
+			Gpio->Pur &= ~(Value & Gpio->Cr);
+			break;
+		case MMIO_SIM_GPIO_LOCK:
+			Gpio->Locked = (MMIO_SIM_GPIO_UNLOCK_VALUE == Value) ? FALSE : TRUE;
+			break;
+		case MMIO_SIM_GPIO_CR:
+			if (FALSE == Gpio->Locked)
+			{
+				Gpio->Cr = Value;
+			}
+			break;
+		case MMIO_SIM_GPIO_AMSEL: Gpio->Amsel = Value; break;
+		case MMIO_SIM_GPIO_PCTL:  Gpio->Pctl  = Value; break;
+		default:
+			*Valid = FALSE;
+			break;
+	}
+}
+
+/*
+ * Common access path of the reads, writes and peeks. Counted accesses advance the clock
+ * ready countdowns, update the counters and are gated by the clocks and the aperture.
+ */
+STATIC uint32 Mmio_SimAccess(uint32 Address, uint32 Value, boolean Write, boolean Counted)
+{
+	uint32 Result = 0U;
+	uint32 Cycles = MMIO_SIM_APB_ACCESS_CYCLES;
+	boolean Valid = TRUE;
+	boolean Instrumentation = FALSE;
+	uint32 BitMask = 0xFFFFFFFFU;
+	uint8 Bit = 0U;
+	uint8 PortNum;
+	uint32 Offset;
+	boolean Ahb;
+
+	/* A bit-band alias word accesses one bit of the peripheral word it maps to */
+	if ((Address >= MMIO_SIM_BITBAND_BASE) && (Address < MMIO_SIM_BITBAND_END))
+	{
+		Bit     = (uint8)(((Address - MMIO_SIM_BITBAND_BASE) >> 2) & 0x1FU);
+		BitMask = (1U << Bit);
+		Address = MMIO_SIM_PERIPHERAL_BASE + (((Address - MMIO_SIM_BITBAND_BASE) >> 5) & ~0x3U);
+	}
+
+	if (TRUE == Counted)
+	{
+		Mmio_SimTick();
+	}
+
+	if (TRUE == Mmio_SimDecodeGpio(Address, &PortNum, &Offset, &Ahb))
+	{
+		Mmio_SimGpioType * Gpio = &Mmio_SimGpio[PortNum];
+
+		Cycles = (TRUE == Ahb) ? MMIO_SIM_AHB_ACCESS_CYCLES : MMIO_SIM_APB_ACCESS_CYCLES;
+		if ((TRUE == Counted) &&
+		    (!(Mmio_SimPrGpio & (1U << PortNum)) || ((TRUE == Ahb) != ((Mmio_SimHbctl >> PortNum) & 1U))))
+		{
+			/* Port not clocked and ready, or accessed through the aperture GPIOHBCTL did not select */
+			Valid = FALSE;
+		}
+		else if (TRUE == Write)
+		{
+			if (0xFFFFFFFFU != BitMask)
+			{
+				/* Read-modify-write of the single bit done by the bus matrix */
+				boolean ReadValid;
+				uint32 Word = Mmio_SimGpioRead(Gpio, Offset, &ReadValid);
+				Value = (Word & ~BitMask) | ((Value & 1U) << Bit);
+			}
+			Mmio_SimGpioWrite(Gpio, Offset, Value, &Valid);
+		}
+		else
+		{
+			Result = Mmio_SimGpioRead(Gpio, Offset, &Valid);
+			if (0xFFFFFFFFU != BitMask)
+			{
+				Result = (Result >> Bit) & 1U;
+			}
+		}
+	}
+	else if ((Address & ~0xFFFU) == MMIO_SIM_SYSCTL_PAGE)
+	{
+		switch (Address & 0xFFFU)
+		{
+			case MMIO_SIM_GPIOHBCTL_OFFSET:
+				if (TRUE == Write) { Mmio_SimHbctl = Value & 0x3FU; } else { Result = Mmio_SimHbctl; }
+				break;
+			case MMIO_SIM_RCGC2_OFFSET:
+			case MMIO_SIM_RCGCGPIO_OFFSET:
+				if (TRUE == Write) { Mmio_SimSetClocks(Value); } else { Result = Mmio_SimRcgcGpio; }
+				break;
+			case MMIO_SIM_PRGPIO_OFFSET:
+				Result = Mmio_SimPrGpio;
+				break;
+			default:
+				Valid = FALSE;
+				break;
+		}
+	}
+	else if (Address >= MMIO_SIM_PPB_BASE)
+	{
+		Mmio_SimCoreRegisterType * Register = Mmio_SimCoreRegister(Address);
+
+		Cycles = MMIO_SIM_PPB_ACCESS_CYCLES;
+		Instrumentation = (((Address & ~0xFFFU) == MMIO_SIM_DWT_PAGE) || (MMIO_SIM_DEMCR == Address)) ? TRUE : FALSE;
+		if (MMIO_SIM_DWT_CYCCNT == Address)
+		{
+			/* The cycle counter of the host build counts the estimated bus cycles */
+			Result = Mmio_SimCounters.BusCycles;
+		}
+		else if (NULL_PTR == Register)
+		{
+			Valid = FALSE;
+		}
+		else if (TRUE == Write)
+		{
+			/* NVIC set enable registers are write one to set */
+			Register->Value = (MMIO_SIM_NVIC_EN0 == Address) ? (Register->Value | Value) : Value;
+		}
+		else
+		{
+			Result = Register->Value;
+		}
+	}
+	else
+	{
+		Valid = FALSE;
+	}
+
+	if ((TRUE == Counted) && (FALSE == Instrumentation))
+	{
+		if (TRUE == Write)
+		{
+			Mmio_SimCounters.Writes++;
+		}
+		else
+		{
+			Mmio_SimCounters.Reads++;
+		}
+		Mmio_SimCounters.BusCycles += Cycles;
+		if (FALSE == Valid)
+		{
+			Mmio_SimCounters.Faults++;
+			Result = 0U;
+		}
+	}
+	return Result;
+}
+
+/*******************************************************************************
+ *                      Public Functions                                       *
+ *******************************************************************************/
+
+void Mmio_SimReset(void)
+{
+	uint8 PortNum;
+
+	for (PortNum = 0U; PortNum < MMIO_SIM_GPIO_PORTS; PortNum++)
+	{
+		Mmio_SimGpioType * Gpio = &Mmio_SimGpio[PortNum];
+
+		Gpio->Out = Gpio->In = Gpio->Dir = 0U;
+		Gpio->Is = Gpio->Ibe = Gpio->Iev = Gpio->Im = Gpio->Ris = 0U;
+		Gpio->Pdr = Gpio->Amsel = 0U;
+		/* Only the JTAG pins PC0-PC3 reset as digital alternate function pins */
+		Gpio->Den    = (2U == PortNum) ? 0x0FU : 0U;
+		Gpio->Afsel  = (2U == PortNum) ? 0x0FU : 0U;
+		Gpio->Pctl   = (2U == PortNum) ? 0x00001111U : 0U;
+		Gpio->Pur    = (2U == PortNum) ? 0x0FU : 0U;
+		Gpio->Cr     = Mmio_SimCrReset[PortNum];
+		Gpio->Locked = TRUE;
+		Mmio_SimReadyCountdown[PortNum] = 0U;
+	}
+	Mmio_SimRcgcGpio = 0U;
+	Mmio_SimPrGpio   = 0U;
+	Mmio_SimHbctl    = 0U;
+	Mmio_SimStalledPorts = 0U;
+	Mmio_SimCoreUsed = 0U;
+	Mmio_SimResetCounters();
+}
+
+void Mmio_SimResetCounters(void)
+{
+	Mmio_SimCounters.Reads     = 0U;
+	Mmio_SimCounters.Writes    = 0U;
+	Mmio_SimCounters.BusCycles = 0U;
+	Mmio_SimCounters.Faults    = 0U;
+}
+
+void Mmio_SimGetCounters(Mmio_SimCountersType * Counters)
+{
+	*Counters = Mmio_SimCounters;
+}
+
+uint32 Mmio_SimRead32(uint32 Address)
+{
+	return Mmio_SimAccess(Address, 0U, FALSE, TRUE);
+}
+
+void Mmio_SimWrite32(uint32 Address, uint32 Value)
+{
+	(void)Mmio_SimAccess(Address, Value, TRUE, TRUE);
+}
+
+uint32 Mmio_SimPeek32(uint32 Address)
+{
+	return Mmio_SimAccess(Address, 0U, FALSE, FALSE);
+}
+
+Std_ReturnType Mmio_SimCheckBudget(const Mmio_SimBudgetType * Budget)
+{
+	if ((Mmio_SimCounters.Reads > Budget->Reads) || (Mmio_SimCounters.Writes > Budget->Writes) ||
+	    (Mmio_SimCounters.BusCycles > Budget->BusCycles) || (Mmio_SimCounters.Faults > 0U))
+	{
+		return E_NOT_OK;
+	}
+	return E_OK;
+}
+
+void Mmio_SimSetPins(uint8 PortNum, uint8 Levels)
+{
+	if (PortNum < MMIO_SIM_GPIO_PORTS)
+	{
+		Mmio_SimGpioType * Gpio = &Mmio_SimGpio[PortNum];
+		uint32 OldPad = Mmio_SimPadLevels(Gpio);
+
+		Gpio->In = Levels;
+		Mmio_SimLatchEdges(Gpio, OldPad, Mmio_SimPadLevels(Gpio));
+	}
+}
+
+uint8 Mmio_SimGetPins(uint8 PortNum)
+{
+	return (PortNum < MMIO_SIM_GPIO_PORTS) ? (uint8)Mmio_SimPadLevels(&Mmio_SimGpio[PortNum]) : 0U;
+}
+
+void Mmio_SimStallClocks(uint32 PortMask)
+{
+	Mmio_SimStalledPorts = PortMask & 0x3FU;
+}
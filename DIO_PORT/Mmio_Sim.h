@@ -0,0 +1,127 @@
+ /******************************************************************************
+ *
+ * Module: Common - MMIO
+ *
+ * File Name: Mmio_Sim.h
+ *
+ * Description: Header file of the simulated TM4C123GH6PM register file used by the
+ *              host build of the Dio and Port drivers.
+ *
+ *              The drivers access every register through Mmio.h, compiling them with
+ *              MMIO_SIMULATION defined routes those accesses here instead of the bus.
+ *              CMakeLists.txt builds the drivers this way with the host tests of the
+ *              Test directory:
+ *
+ *                cmake -S . -B build && cmake --build build && ctest --test-dir build
+ *
+ *              The model covers:
+ *              - GPIO ports A --> F on both the APB and the AHB apertures, selected by GPIOHBCTL,
+ *                with the GPIODATA address-mask aperture and the bit-band alias of GPIODATA.
+ *              - DIR, AFSEL, PUR, PDR, DEN, AMSEL, PCTL and the edge interrupt registers
+ *                (IS, IBE, IEV, IM, RIS, MIS, ICR). Pin changes latch RIS like the hardware.
+ *              - GPIOLOCK/GPIOCR: the commit protected registers (AFSEL, PUR, PDR, DEN) only
+ *                change on bits set in GPIOCR, and GPIOCR is writable only while unlocked.
+ *                PC0-PC3, PD7 and PF0 reset with their GPIOCR bit cleared.
+ *              - RCGC2/RCGCGPIO clock gating and PRGPIO: a port becomes ready on the
+ *                MMIO_SIM_CLOCK_READY_ACCESSES-th bus access after its clock is enabled,
+ *                so at least one access has to separate the enable from the first port access.
+ *              - A plain store for the core registers (SysTick, NVIC, DEMCR, DWT).
+ *
+ *              Accessing a port which is not clocked and ready, through the wrong aperture,
+ *              or at an address which is not modelled counts a fault: reads return 0 and
+ *              writes are dropped.
+ *
+ *              DWT_CYCCNT reads return the estimated bus cycles of all the counted accesses,
+ *              so Dio_GetProfile/Port_GetProfile report the bus cost of each service. The DWT
+ *              and DEMCR accesses themselves are instrumentation and are not counted.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef MMIO_SIM_H
+#define MMIO_SIM_H
+
+#include "Std_Types.h"
+
+/*******************************************************************************
+ *                              Module Definitions                             *
+ *******************************************************************************/
+
+/* Number of simulated GPIO ports, 0 --> PORTA ... 5 --> PORTF */
+#define MMIO_SIM_GPIO_PORTS                 (6U)
+
+/* Bus accesses after a clock enable until the port reports ready in PRGPIO */
+#define MMIO_SIM_CLOCK_READY_ACCESSES       (2U)
+
+/*
+ * Estimated bus cycles per access (estimates from the bus structure, not measurements):
+ * the AHB GPIO aperture and the private peripheral bus take one cycle, the legacy APB
+ * GPIO aperture and the system control block take two because of the APB bridge.
+ */
+#define MMIO_SIM_AHB_ACCESS_CYCLES          (1U)
+#define MMIO_SIM_APB_ACCESS_CYCLES          (2U)
+#define MMIO_SIM_PPB_ACCESS_CYCLES          (1U)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Access counters, accumulated since the last Mmio_SimReset/Mmio_SimResetCounters */
+typedef struct
+{
+	/* Number of register reads */
+	uint32 Reads;
+	/* Number of register writes */
+	uint32 Writes;
+	/* Estimated bus cycles of the counted reads and writes */
+	uint32 BusCycles;
+	/* Accesses to an unclocked port, through the wrong aperture or to an unmodelled address */
+	uint32 Faults;
+}Mmio_SimCountersType;
+
+/* Access budget of one service call, see Mmio_Budget.h */
+typedef struct
+{
+	/* Maximum number of register reads */
+	uint32 Reads;
+	/* Maximum number of register writes */
+	uint32 Writes;
+	/* Maximum estimated bus cycles */
+	uint32 BusCycles;
+}Mmio_SimBudgetType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function to put every simulated register to its reset value and clear the counters */
+void Mmio_SimReset(void);
+
+/* Function to clear the access counters, the registers keep their values */
+void Mmio_SimResetCounters(void);
+
+/* Function to copy the access counters to Counters */
+void Mmio_SimGetCounters(Mmio_SimCountersType * Counters);
+
+/* Function to read the 32-bit register at Address, called through MMIO_READ32 */
+uint32 Mmio_SimRead32(uint32 Address);
+
+/* Function to write the 32-bit register at Address, called through MMIO_WRITE32 */
+void Mmio_SimWrite32(uint32 Address, uint32 Value);
+
+/* Function to return the value of the register at Address without counting nor gating the access */
+uint32 Mmio_SimPeek32(uint32 Address);
+
+/* Function to check the counters against Budget, returns E_NOT_OK if one is exceeded or an access faulted */
+Std_ReturnType Mmio_SimCheckBudget(const Mmio_SimBudgetType * Budget);
+
+/* Function to drive the external level of the pins of port PortNum, the input pins see Levels */
+void Mmio_SimSetPins(uint8 PortNum, uint8 Levels);
+
+/* Function to return the pad levels of port PortNum: output latch on the outputs, external level on the inputs */
+uint8 Mmio_SimGetPins(uint8 PortNum);
+
+/* Function to keep the ports of PortMask (bit n --> port n) from ever reporting ready in PRGPIO, until Mmio_SimReset */
+void Mmio_SimStallClocks(uint32 PortMask);
+
+#endif /* MMIO_SIM_H */
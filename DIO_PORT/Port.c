@@ -13,6 +13,7 @@
 #include "tm4c123gh6pm_registers.h"
 
 #include "Port_Regs.h"
+#include "Mmio.h"
 
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
 
@@ -31,13 +32,226 @@
   *be called if the Port module was uninitialized*/
  STATIC uint8 Port_Status = PORT_NOT_INITIALIZED;
 
-  /*Static global variable to hold the status of the JTAG
-   *pins to secure them and prevent the access to them*/
-  STATIC uint8 JTAG_flag = STD_LOW;
-
  /* Holds the pointer of the Port_PinConfig */
  STATIC const Port_ConfigType* Port_ConfigPtr = NULL_PTR;
 
+ /* Runtime pin database of the configuration set, built by Port_Init */
+ STATIC Port_PinDatabaseType Port_PinDb;
+
+#if (PORT_PINMUX_SET_API == STD_ON)
+ /* Pin-mux set of the active configuration set, PORT_NUMBER_OF_PIN_MUX_SETS if it is not one of the pin-mux sets */
+ STATIC Port_PinMuxSetType Port_ActivePinMuxSet = PORT_NUMBER_OF_PIN_MUX_SETS;
+#endif
+
+#if (PORT_PROFILING_API == STD_ON)
+ /* Cycle count statistics of the Port services indexed by their service ID */
+ STATIC Profiling_StatType Port_Profile[PORT_PROFILING_SIDS];
+
+ /* Bracket a service, the END point shall be reached on every return path */
+ #define PORT_PROFILE_BEGIN()     uint32 Port_ProfileStart = PROFILING_GET_CYCLES()
+ #define PORT_PROFILE_END(SID)    Profiling_Record(&Port_Profile[(SID)], PROFILING_GET_CYCLES() - Port_ProfileStart)
+#else
+ /* Profiling points compile to nothing */
+ #define PORT_PROFILE_BEGIN()
+ #define PORT_PROFILE_END(SID)
+#endif
+
+ /* Registers base address of each port through the configured aperture */
+ STATIC const uint32 Port_BaseAddress[PORT_NUMBER_OF_PORTS] =
+ {
+   GPIO_PORTA_BASE_ADDRESS, GPIO_PORTB_BASE_ADDRESS, GPIO_PORTC_BASE_ADDRESS,
+   GPIO_PORTD_BASE_ADDRESS, GPIO_PORTE_BASE_ADDRESS, GPIO_PORTF_BASE_ADDRESS
+ };
+
+ /* Pins implemented in each port, a register update covering all of them is a plain store */
+ STATIC const uint8 Port_ImplementedPins[PORT_NUMBER_OF_PORTS] =
+ {
+   PORT_ALL_PINS_MASK, PORT_ALL_PINS_MASK, PORT_ALL_PINS_MASK,
+   PORT_ALL_PINS_MASK, PORT_E_PINS_MASK, PORT_F_PINS_MASK
+ };
+
+/* GPIOPCTL mask of the PMCx fields of the pins in PinMask */
+STATIC uint32 Port_CtlMask(uint8 PinMask)
+{
+  uint32 Mask = 0U;
+  uint8 Bit;
+  
+  for (Bit = 0U; Bit < 8U; Bit++)
+  {
+    if (PinMask & (1U << Bit))
+    {
+      Mask |= (0x0000000FU << (Bit * 4U));
+    }
+  }
+  return Mask;
+}
+
+/* Write the Mask bits of the register at Address: plain store when the mask covers FullMask (every
+ * implemented bit of the register), else read-modify-write */
+STATIC void Port_WriteMasked(uint32 Address, uint32 Mask, uint32 FullMask, uint32 Value)
+{
+  if (Mask == FullMask)
+  {
+    MMIO_WRITE32(Address, Value);
+  }
+  else
+  {
+    MMIO_WRITE32(Address, (MMIO_READ32(Address) & ~Mask) | (Value & Mask));
+  }
+}
+
+/************************************************************************************
+* Function Name: Port_WriteImage
+* Description: Write the image of one port, each register once in the order the hardware
+*              requires: commit of the locked pins, analog/alternate function selection,
+*              initial output levels before the direction, pulls, digital enable and last
+*              the edge interrupts. A register whose configured pins are all the pins of the
+*              port is written with a plain store, the others with a read-modify-write.
+************************************************************************************/
+STATIC void Port_WriteImage(uint8 PortNum, const Port_RegisterImageType * Image)
+{
+  uint32 Base = Port_BaseAddress[PortNum];
+  uint32 Pins = Image->Pins;
+  uint32 FullMask = Port_ImplementedPins[PortNum];
+  
+  if (Image->Commit != 0U)
+  {
+    /* Unlock the GPIOCR register then allow changes on the locked pins */
+    MMIO_WRITE32(Base + PORT_LOCK_REG_OFFSET, UNLOCK_VALUE);
+    MMIO_SET_BITS32(Base + PORT_COMMIT_REG_OFFSET, Image->Commit);
+  }
+  
+  Port_WriteMasked(Base + PORT_ANALOG_MODE_SEL_REG_OFFSET, Pins, FullMask, Image->Analog);
+  Port_WriteMasked(Base + PORT_CTL_REG_OFFSET, Port_CtlMask(Image->Pins), Port_CtlMask(Port_ImplementedPins[PortNum]), Image->Ctl);
+  Port_WriteMasked(Base + PORT_ALT_FUNC_REG_OFFSET, Pins, FullMask, Image->AltFunc);
+  
+  if (Image->DataMask != 0U)
+  {
+    /* The GPIODATA address-mask aperture writes only the output pins, a plain store */
+    MMIO_WRITE32(Base + ((uint32)Image->DataMask << 2), Image->Data);
+  }
+  
+  Port_WriteMasked(Base + PORT_DIR_REG_OFFSET, Pins, FullMask, Image->Dir);
+  Port_WriteMasked(Base + PORT_PULL_UP_REG_OFFSET, Pins, FullMask, Image->PullUp);
+  Port_WriteMasked(Base + PORT_PULL_DOWN_REG_OFFSET, Pins, FullMask, Image->PullDown);
+  Port_WriteMasked(Base + PORT_DIGITAL_ENABLE_REG_OFFSET, Pins, FullMask, Image->DigitalEnable);
+  
+  if (Image->IntPins != 0U)
+  {
+    /* Mask the pin interrupts while they are configured as edge sensitive */
+    Port_WriteMasked(Base + PORT_INT_MASK_REG_OFFSET, Image->IntPins, FullMask, 0U);
+    Port_WriteMasked(Base + PORT_INT_SENSE_REG_OFFSET, Image->IntPins, FullMask, 0U);
+    Port_WriteMasked(Base + PORT_INT_BOTH_EDGES_REG_OFFSET, Image->IntPins, FullMask, Image->IntBothEdges);
+    Port_WriteMasked(Base + PORT_INT_EVENT_REG_OFFSET, Image->IntPins, FullMask, Image->IntEvent);
+    
+    /* Clear any edge latched during the configuration then unmask the pin interrupts */
+    MMIO_WRITE32(Base + PORT_INT_CLEAR_REG_OFFSET, Image->IntPins);
+    Port_WriteMasked(Base + PORT_INT_MASK_REG_OFFSET, Image->IntPins, FullMask, Image->IntPins);
+  }
+}
+
+/************************************************************************************
+* Function Name: Port_WriteImages
+* Description: Write the port images of the configuration to the hardware. The clocks of all
+*              the used ports are enabled by one write, then each port is configured as soon
+*              as the peripheral ready register reports it, so the ports already clocked are
+*              written while the others are still settling. Returns E_NOT_OK if a port is not
+*              ready after PORT_CLOCK_READY_POLLS reads of PRGPIO, that port is not written.
+************************************************************************************/
+STATIC Std_ReturnType Port_WriteImages(const Port_RegisterImageType * Images)
+{
+  uint32 ClockMask = 0U;
+  uint32 IrqMask = 0U;
+  uint32 Pending;
+  uint32 Polls;
+  uint8 PortNum;
+  
+  for (PortNum = 0U; PortNum < PORT_NUMBER_OF_PORTS; PortNum++)
+  {
+    if (Images[PortNum].Pins != 0U)
+    {
+      ClockMask |= (1U << PortNum);
+    }
+    if (Images[PortNum].IntPins != 0U)
+    {
+      IrqMask |= (1UL << PORT_GPIO_IRQ_NUM(PortNum));
+    }
+  }
+  
+  /* Enable the clock of all the used PORTs at once, the ports clocked by someone else stay clocked */
+  MMIO_WRITE32(SYSCTL_RCGCGPIO_ADDRESS, MMIO_READ32(SYSCTL_RCGCGPIO_ADDRESS) | ClockMask);
+  
+  /* Select the AHB aperture for the configured ports and the legacy APB aperture for the others
+   * while the clocks start, GPIOHBCTL does not need the GPIO clocks */
+  MMIO_WRITE32(SYSCTL_GPIOHBCTL_ADDRESS, (MMIO_READ32(SYSCTL_GPIOHBCTL_ADDRESS) & ~PORT_GPIO_HBCTL_PORTS_MASK) | PORT_GPIO_AHB_PORTS_MASK);
+  
+  /* Configure each port once PRGPIO reports it ready instead of waiting a fixed time for all of them */
+  Pending = ClockMask;
+  for (Polls = 0U; (Pending != 0U) && (Polls < PORT_CLOCK_READY_POLLS); Polls++)
+  {
+    uint32 Ready = MMIO_READ32(SYSCTL_PRGPIO_ADDRESS) & Pending;
+    
+    for (PortNum = 0U; PortNum < PORT_NUMBER_OF_PORTS; PortNum++)
+    {
+      if (Ready & (1U << PortNum))
+      {
+        Port_WriteImage(PortNum, &Images[PortNum]);
+      }
+    }
+    Pending &= ~Ready;
+  }
+  
+  if ((IrqMask != 0U) && (Pending == 0U))
+  {
+    /* Enable the interrupts of the ports in the NVIC */
+    MMIO_WRITE32(NVIC_EN0_ADDRESS, IrqMask);
+  }
+  
+  return (Pending == 0U) ? E_OK : E_NOT_OK;
+}
+
+
+/************************************************************************************
+* Function Name: Port_BuildPinDatabase
+* Description: Fold the Pins rows of the configuration set into the runtime pin database.
+************************************************************************************/
+STATIC void Port_BuildPinDatabase(const Port_ConfigType * ConfigPtr)
+{
+  Port_PinType Pin;
+  uint8 PortNum;
+  
+  for (PortNum = 0U; PortNum < PORT_NUMBER_OF_PORTS; PortNum++)
+  {
+    Port_PinDb.Protected[PortNum] = 0U;
+    Port_PinDb.DirChangeable[PortNum] = 0U;
+    Port_PinDb.ModeChangeable[PortNum] = 0U;
+  }
+  
+  for (Pin = 0U; Pin < PORT_CONFIGURED_PINS; Pin++)
+  {
+    const Port_ConfigPin * Row = &ConfigPtr->Pins[Pin];
+    uint8 Bit = (uint8)PORT_PIN_BIT(Row->Port_Num, Row->Pin_Num);
+    uint8 Mask = (uint8)(1U << Bit);
+    
+    Port_PinDb.Base[Pin] = Port_BaseAddress[Row->Port_Num];
+    Port_PinDb.Port[Pin] = Row->Port_Num;
+    Port_PinDb.Mask[Pin] = Mask;
+    Port_PinDb.CtlShift[Pin] = (uint8)(Bit * 4U);
+    
+    if (PORT_IS_JTAG_PIN(Row->Pin_Num))
+    {
+      Port_PinDb.Protected[Row->Port_Num] |= Mask;
+    }
+    if (Row->Pin_direction_change == Pin_direction_changeable_ON)
+    {
+      Port_PinDb.DirChangeable[Row->Port_Num] |= Mask;
+    }
+    if (Row->Pin_modeChange == Pin_mode_changeable_ON)
+    {
+      Port_PinDb.ModeChangeable[Row->Port_Num] |= Mask;
+    }
+  }
+}
 
 /************************************************************************************
 * Service Name: Port_Init
@@ -55,184 +269,60 @@
 ************************************************************************************/
 void Port_Init(const Port_ConfigType* ConfigPtr)
 {
+  boolean error = FALSE;
+  PORT_PROFILE_BEGIN();
+  
   #if (PORT_DEV_ERROR_DETECT == STD_ON)
 	/* check if the input configuration pointer is not a NULL_PTR */
 	if (NULL_PTR == ConfigPtr)
 	{
 		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, Port_Init_SID,
 		     PORT_E_PARAM_CONFIG);
+		error = TRUE;
 	}
 	else
         { /*do nothing*/ }
   #endif
-        
-  Port_Status = PORT_INITIALIZED;
-  Port_ConfigPtr = ConfigPtr;
-  
-  volatile uint32 *PortGpio_Ptr = NULL_PTR; /* Pointer to point to the required Port Registers base address */
-  volatile uint32 delay = 0;
   
-  for (Port_PinType index = 0; index < PORT_CONFIGURED_PINS; index++)
+  /* In-case there are no errors */
+  if (FALSE == error)
   {
-    switch (Port_ConfigPtr-> Pins[index].Port_Num)
-    {
-      case 0: 
-        PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-	break;
-      case 1: 
-        PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-	break;
-      case 2: 
-        PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-	break;
-      case 3: 
-        PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-	break;
-      case 4: 
-        PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-	break;
-      case 5: 
-        PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-	break;
-    }
-    
-    /* Enable clock for PORT and allow time for clock to start*/
-    SYSCTL_REGCGC2_REG |= (1<< (Port_ConfigPtr->Pins[index].Port_Num));
-    delay = SYSCTL_REGCGC2_REG;
-    
+    Port_Status = PORT_NOT_INITIALIZED;
+    Port_ConfigPtr = ConfigPtr;
     
-     /*Unlocking locked pins to be able to configure and use them*/
-    if( ((Port_ConfigPtr->Pins[index].Port_Num == PORT_D) && (Port_ConfigPtr->Pins[index].Port_Num == NMI_PIN2)) || ((Port_ConfigPtr->Pins[index].Port_Num == PORT_F) && (Port_ConfigPtr->Pins[index].Port_Num == NMI_PIN1)) ) /* PD7 or PF0 */
+    /* The register images are generated at build time with the configuration, write them port by port */
+    if (E_OK == Port_WriteImages(ConfigPtr->Images))
     {
-      /* Unlock the GPIOCR register */  
-      *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_LOCK_REG_OFFSET) = UNLOCK_VALUE; 
-      
-      /* Set the corresponding bit in GPIOCR register to allow changes on this pin */
-      SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_COMMIT_REG_OFFSET) , Port_ConfigPtr->Pins[index].Pin_Num);      
-    }
-    
-    else if(  
-            ( (Port_ConfigPtr->Pins[index].Port_Num == PORT_C) && (Port_ConfigPtr->Pins[index].Pin_Num == JTAG_PIN1) )||
-            ( (Port_ConfigPtr->Pins[index].Port_Num == PORT_C) && (Port_ConfigPtr->Pins[index].Pin_Num == JTAG_PIN2) )||
-            ( (Port_ConfigPtr->Pins[index].Port_Num == PORT_C) && (Port_ConfigPtr->Pins[index].Pin_Num == JTAG_PIN3) )||
-            ( (Port_ConfigPtr->Pins[index].Port_Num == PORT_C) && (Port_ConfigPtr->Pins[index].Pin_Num == JTAG_PIN4) ))
-    {
-        /* Do Nothing ...  this is the JTAG pins */
-        
-        JTAG_flag = STD_HIGH;
+      Port_Status = PORT_INITIALIZED;
     }
     else
     {
-        /* Do Nothing ... No need to unlock the commit register for this pin */
-    }
-    
-    if(Port_ConfigPtr->Pins[index].Pin_Mode == PORT_DIO_MODE)
-    {
-        /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-	CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_ConfigPtr->Pins[index].Pin_Num);
-
-	/* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-	CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_ConfigPtr->Pins[index].Pin_Num);
-
-	/* Clear the PMCx bits for this pin */
-	*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_ConfigPtr->Pins[index].Pin_Num * 4));
-        
-        /*If output pin*/
-        if(Port_ConfigPtr->Pins[index].Pin_Direction == PORT_PIN_OUT)
-         {
-           /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-           SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_ConfigPtr->Pins[index].Pin_Num);                                    
-            
-           if(Port_ConfigPtr->Pins[index].Pin_initial_value== STD_HIGH)
-            {
-              /* Set the corresponding bit in the GPIODATA register to provide initial value 1 */
-              SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET) ,Port_ConfigPtr->Pins[index].Pin_Num);          
-            }
-            else
-            {
-              /* Clear the corresponding bit in the GPIODATA register to provide initial value 0 */
-              CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET) , Port_ConfigPtr->Pins[index].Pin_Num);                    
-            }
-          }
-         /*If Input pin*/
-         else if(Port_ConfigPtr->Pins[index].Pin_Direction == PORT_PIN_IN)
-         {
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_ConfigPtr->Pins[index].Pin_Num); 
-            
-            if(Port_ConfigPtr->Pins[index].resistor == PULL_UP)
-            {
-              /* Set the corresponding bit in the GPIOPUR register to enable the internal pull up pin */
-              SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET) , Port_ConfigPtr->Pins[index].Pin_Num);                   
-            }
-            
-            else if(Port_ConfigPtr->Pins[index].resistor == PULL_DOWN)
-            {
-              /* Set the corresponding bit in the GPIOPDR register to enable the internal pull down pin */
-              SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET) , Port_ConfigPtr->Pins[index].Pin_Num);                 
-            }
-            
-            else
-            {
-              /* Clear the corresponding bit in the GPIOPUR register to disable the internal pull up pin */                   
-              CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET) , Port_ConfigPtr->Pins[index].Pin_Num);                   
-              
-              /* Clear the corresponding bit in the GPIOPDR register to disable the internal pull down pin */                
-              CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET) , Port_ConfigPtr->Pins[index].Pin_Num);               
-            }
-          }
-          else
-          {
-            /* Do Nothing */
-          }
-        
-        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-	SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_ConfigPtr->Pins[index].Pin_Num);
-    
+      /* A port never got its clock, the module stays uninitialized */
+    #if (PORT_DEV_ERROR_DETECT == STD_ON)
+      Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, Port_Init_SID, PORT_E_CLOCK_NOT_READY);
+    #endif
     }
+    Port_BuildPinDatabase(ConfigPtr);
     
-    /*Configure Analog mode used for ADC only*/
-    else if(Port_ConfigPtr->Pins[index].Pin_Mode == PORT_ALTERNATE_FUNCTION_ADC_MODE)
+#if (PORT_PINMUX_SET_API == STD_ON)
+    /* Find the pin-mux set of the configuration set so Port_SwitchPinMuxSet knows what is written */
+    for (Port_ActivePinMuxSet = 0U; Port_ActivePinMuxSet < PORT_NUMBER_OF_PIN_MUX_SETS; Port_ActivePinMuxSet++)
     {
-      /* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
-      CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_ConfigPtr->Pins[index].Pin_Num);   
-      
-      if(Port_ConfigPtr->Pins[index].Pin_Direction== PORT_PIN_OUT)
+      if (Port_PinMuxSets.Sets[Port_ActivePinMuxSet] == ConfigPtr)
       {
-         /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_ConfigPtr->Pins[index].Pin_Num);                     
-      }
-      else if(Port_ConfigPtr->Pins[index].Pin_Direction == PORT_PIN_IN)
-      {
-        /* clear the corresponding bit in the GPIODIR register to configure it as input pin */              
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_ConfigPtr->Pins[index].Pin_Num);                      
-      }
-      
-     /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */      
-      SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_ConfigPtr->Pins[index].Pin_Num);                 
-     }
-
-     /*If any other alternative functionality between DIO Id and ADC id*/
-     else if((Port_ConfigPtr->Pins[index].Pin_Mode > PORT_DIO_MODE) && (Port_ConfigPtr->Pins[index].Pin_Mode < PORT_ALTERNATE_FUNCTION_ADC_MODE))
-     {
-        /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-        CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_ConfigPtr->Pins[index].Pin_Num);  
-        
-        /* enable Alternative function for this pin by Setting the corresponding bit in GPIOAFSEL register */
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_ConfigPtr->Pins[index].Pin_Num);
-        
-        /* Clear the PMCx bits for this pin */
-        *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << ((Port_ConfigPtr->Pins[index].Pin_Num) * 4));
-        
-        /* Set the PMCx bits for this pin to the selected Alternate function in the configurations */
-        *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (Port_ConfigPtr->Pins[index].Pin_Mode<< ((Port_ConfigPtr->Pins[index].Pin_Num)* 4)); 
-        
-        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_ConfigPtr->Pins[index].Pin_Num);                           
+        break;
       }
+    }
+#endif
+  }
+  else
+  {
+    /* No Action Required */
   }
+  PORT_PROFILE_END(Port_Init_SID);
 }
     
-#if (Port_Set_Pin_Direction_Api == STD_ON)
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
 
 /************************************************************************************
 * Service Name: Port_SetPinDirection
@@ -252,9 +342,7 @@ void Port_Init(const Port_ConfigType* ConfigPtr)
 void Port_SetPinDirection( Port_PinType Pin, Port_PinDirectionType Direction )
 {
    boolean error = FALSE;
-   
-   /* point to the required Port Registers base address */
-   volatile uint32 * Port_directionPtr = NULL_PTR; 
+   PORT_PROFILE_BEGIN();
   
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
   /*Check if the API service called prior to module initialization*/
@@ -276,7 +364,7 @@ void Port_SetPinDirection( Port_PinType Pin, Port_PinDirectionType Direction )
 	{
 		Det_ReportError(PORT_MODULE_ID, 
                                 PORT_INSTANCE_ID, 
-                                Port_Init_SID,
+                                Port_Set_Pin_Direction_SID,
                                 PORT_E_PARAM_PIN);
                 error = TRUE;
 	} 
@@ -285,11 +373,11 @@ void Port_SetPinDirection( Port_PinType Pin, Port_PinDirectionType Direction )
           /* Do nothing*/
 	}
         
-        if(((*Port_ConfigPtr->Pins)[Pin]).Pin_direction_changeable == PIN_DIRECTION_CHANGEABLE_OFF)
+        if((FALSE == error) && !(Port_PinDb.DirChangeable[Port_PinDb.Port[Pin]] & Port_PinDb.Mask[Pin]))
         {
           Det_ReportError(PORT_MODULE_ID, 
                           PORT_INSTANCE_ID, 
-                          Port_Init_SID,
+                          Port_Set_Pin_Direction_SID,
                           PORT_E_DIRECTION_UNCHANGEABLE);
           error = TRUE;
         }
@@ -302,54 +390,33 @@ void Port_SetPinDirection( Port_PinType Pin, Port_PinDirectionType Direction )
   /* In-case there are no errors */
   if(FALSE == error)
   {
-    Port_Status = PORT_INITIALIZED;
-	
-    switch(Port_ConfigPtr->Pins[Pin].Port_Num)
-    {
-        case  0: Port_directionPtr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-		 break; 
-	case  1: Port_directionPtr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-		 break;
-	case  2: Port_directionPtr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-		 break;
-	case  3: Port_directionPtr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-		 break;
-        case  4: Port_directionPtr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-		 break;
-        case  5: Port_directionPtr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-		 break;
-    }
+    uint32 Address = Port_PinDb.Base[Pin] + PORT_DIR_REG_OFFSET;
+    uint8 Mask = Port_PinDb.Mask[Pin];
     
     /*Preventing any actions to be done upon JTAG pins*/
-    if(  
-        ( (Port_ConfigPtr->Pins[Pin].Port_Num == PORT_C) && (Port_ConfigPtr->Pins[Pin].Pin_Num == JTAG_PIN1) )||
-        ( (Port_ConfigPtr->Pins[Pin].Port_Num == PORT_C) && (Port_ConfigPtr->Pins[Pin].Pin_Num == JTAG_PIN2) )||
-        ( (Port_ConfigPtr->Pins[Pin].Port_Num == PORT_C) && (Port_ConfigPtr->Pins[Pin].Pin_Num == JTAG_PIN3) )||
-        ( (Port_ConfigPtr->Pins[Pin].Port_Num == PORT_C) && (Port_ConfigPtr->Pins[Pin].Pin_Num == JTAG_PIN4) ))
+    if(Port_PinDb.Protected[Port_PinDb.Port[Pin]] & Mask)
     {
         /* Do Nothing ...  this is the JTAG pins */
-        JTAG_flag = STD_HIGH;
     }
-    
     else
     {
       switch (Direction)
       {
         case PORT_PIN_IN: 
-             CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_directionPtr + PORT_DIR_REG_OFFSET) , Pin);
+             MMIO_CLEAR_BITS32(Address, Mask);
              break; 
             
         case PORT_PIN_OUT:
-             SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_directionPtr + PORT_DIR_REG_OFFSET) , Pin); 
+             MMIO_SET_BITS32(Address, Mask); 
              break;
              
         default:
              /*do nothing*/
              break;
-            
-                }/*End of the switch..case*/
-          }/*end of the else condition*/
-      }/*end of the if(FALSE == error)*/
+      }/*End of the switch..case*/
+    }/*end of the else condition*/
+  }/*end of the if(FALSE == error)*/
+  PORT_PROFILE_END(Port_Set_Pin_Direction_SID);
 }
 
 #endif
@@ -367,6 +434,10 @@ void Port_SetPinDirection( Port_PinType Pin, Port_PinDirectionType Direction )
 ************************************************************************************/
 void Port_RefreshPortDirection(void)
 {
+   boolean error = FALSE;
+   uint8 PortNum;
+   PORT_PROFILE_BEGIN();
+   
    #if (PORT_DEV_ERROR_DETECT == STD_ON)
        /* Check if the Driver is initialized before using this function */
 	if(Port_Status == PORT_NOT_INITIALIZED)
@@ -375,6 +446,7 @@ void Port_RefreshPortDirection(void)
                             PORT_INSTANCE_ID, 
                             Port_Refresh_Port_Direction_SID, 
                             PORT_E_UNINIT);
+	    error = TRUE;
 	}
 	else
 	{	
@@ -382,71 +454,23 @@ void Port_RefreshPortDirection(void)
         }
    #endif
 
-   for(Port_PinType index = 0; index < PORT_CONFIGURED_PINS; index++)
+   /* In-case there are no errors */
+   if(FALSE == error)
    {
-     /* point to the required Port Registers base address */
-     volatile uint32 * PortGpio_Ptr = NULL_PTR; 
-     
-     switch(Port_ConfigPtr->Pins[index].Port_Num)
+     /* One masked GPIODIR update per port: only the pins whose direction is not changeable are
+      * restored, the direction changeable pins keep the direction set at runtime and the JTAG
+      * pins are never in the mask. A mask covering all the pins of the port is a plain store */
+     for (PortNum = 0U; PortNum < PORT_NUMBER_OF_PORTS; PortNum++)
      {
-	case  0: 
-          PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-          break;
-	case  1: 
-          PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-          break;
-	case  2: 
-          PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-          break;
-	case  3: 
-          PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-          break;
-	case  4: 
-          PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-          break;
-	case  5: 
-          PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-          break;
+       const Port_RegisterImageType * Image = &Port_ConfigPtr->Images[PortNum];
+       
+       if (Image->RefreshMask != 0U)
+       {
+         Port_WriteMasked(Port_BaseAddress[PortNum] + PORT_DIR_REG_OFFSET, Image->RefreshMask, Port_ImplementedPins[PortNum], Image->Dir);
+       }
      }
-    /*Preventing any actions to be done upon JTAG pins*/
-    if(  
-       ( (Port_ConfigPtr->Pins[index].Port_Num == PORT_C) && (Port_ConfigPtr->Pins[index].Pin_Num == JTAG_PIN1) )||
-       ( (Port_ConfigPtr->Pins[index].Port_Num == PORT_C) && (Port_ConfigPtr->Pins[index].Pin_Num == JTAG_PIN2) )||
-       ( (Port_ConfigPtr->Pins[index].Port_Num == PORT_C) && (Port_ConfigPtr->Pins[index].Pin_Num == JTAG_PIN3) )||
-       ( (Port_ConfigPtr->Pins[index].Port_Num == PORT_C) && (Port_ConfigPtr->Pins[index].Pin_Num == JTAG_PIN4) ))
-    {
-        /* Do Nothing ...  this is the JTAG pins */
-        JTAG_flag = STD_HIGH;
-    }
-    else 
-    {
-    }
-    
-    if (JTAG_flag == STD_LOW)
-    {
-      if (Port_ConfigPtr->Pins[index].Pin_direction_change == STD_OFF)
-      {
-        if(Port_ConfigPtr->Pins[index].Pin_Direction == PORT_PIN_OUT)
-        {
-          /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-          SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_ConfigPtr->Pins[index].Pin_Num);
-        }
-        else if(Port_ConfigPtr->Pins[index].Pin_Direction == PORT_PIN_IN)
-        {
-          /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-          CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_ConfigPtr->Pins[index].Pin_Num);
-        }
-        else
-        {	
-            /* Do Nothing */	
-        }
-      }
-    }
-    else
-    {	
-      /* Do Nothing */	
-    }
-  }
+   }
+  PORT_PROFILE_END(Port_Refresh_Port_Direction_SID);
 }
 
 /************************************************************************************
@@ -463,6 +487,8 @@ void Port_RefreshPortDirection(void)
 #if (PORT_VERSION_INFO_API == STD_ON)
 void Port_GetVersionInfo(Std_VersionInfoType* versioninfo)
 {
+  PORT_PROFILE_BEGIN();
+  
   #if (PORT_DEV_ERROR_DETECT == STD_ON)
   /* check if the input configuration pointer is not a NULL_PTR */
   if(versioninfo == NULL_PTR)
@@ -494,6 +520,7 @@ void Port_GetVersionInfo(Std_VersionInfoType* versioninfo)
   versioninfo->sw_minor_version = (uint8)PORT_SW_MINOR_VERSION;
   /* Copy Software Patch Version */
   versioninfo->sw_patch_version = (uint8)PORT_SW_PATCH_VERSION;
+  PORT_PROFILE_END(Port_Get_Version_Info_SID);
 }
 #endif
 
@@ -511,11 +538,15 @@ void Port_GetVersionInfo(Std_VersionInfoType* versioninfo)
 #if (PORT_SET_PIN_MODE_API == STD_ON)
 void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
 {
+	boolean error = FALSE;
+	PORT_PROFILE_BEGIN();
+	
 	#if (PORT_DEV_ERROR_DETECT == STD_ON)
 		/* Check if the Driver is initialized before using this function */
 		if(Port_Status == PORT_NOT_INITIALIZED)
 		{
 			Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, Port_Set_Pin_Mode_SID, PORT_E_UNINIT);
+			error = TRUE;
 		}
 		else
 		{	/* Do Nothing */	}
@@ -524,93 +555,500 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
 		if(Pin >= PORT_CONFIGURED_PINS)
 		{
 			Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, Port_Set_Pin_Mode_SID, PORT_E_PARAM_PIN);
+			error = TRUE;
 		}
 		else
 		{	/* Do Nothing */	}
 
 		/* check if the Port Pin Mode passed not valid */
-		if(Mode > PORT_DIO_MODE)
+		if(Mode > PORT_ALTERNATE_FUNCTION_ADC_MODE)
 		{
 			Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, Port_Set_Pin_Mode_SID, PORT_E_PARAM_INVALID_MODE);
+			error = TRUE;
 		}
 		else
 		{	/* Do Nothing */	}
 
 		/* check if the API called when the mode is unchangeable */
-		if(Port_ConfigPtr->Pins[Pin].Pin_modeChange == STD_OFF)
+		if((FALSE == error) && !(Port_PinDb.ModeChangeable[Port_PinDb.Port[Pin]] & Port_PinDb.Mask[Pin]))
 		{
 			Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, Port_Set_Pin_Mode_SID, PORT_E_MODE_UNCHANGEABLE);
+			error = TRUE;
 		}
 		else
 		{	/* Do Nothing */	}
 	#endif
 
-	volatile uint32 * PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
+	/* In-case there are no errors, the JTAG pins PC0 to PC3 are never changed */
+	if((FALSE == error) && !(Port_PinDb.Protected[Port_PinDb.Port[Pin]] & Port_PinDb.Mask[Pin]))
+	{
+		uint32 PortGpio_Base = Port_PinDb.Base[Pin]; /* Base address of the required Port Registers */
+		uint8 Mask = Port_PinDb.Mask[Pin];
+		uint32 CtlShift = Port_PinDb.CtlShift[Pin];
+
+		if (Mode == PORT_DIO_MODE)
+		{
+			/* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
+			MMIO_CLEAR_BITS32(PortGpio_Base + PORT_ANALOG_MODE_SEL_REG_OFFSET, Mask);
+
+			/* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
+			MMIO_CLEAR_BITS32(PortGpio_Base + PORT_ALT_FUNC_REG_OFFSET, Mask);
+
+			/* Clear the PMCx bits for this pin */
+			MMIO_CLEAR_BITS32(PortGpio_Base + PORT_CTL_REG_OFFSET, (0x0000000FU << CtlShift));
+
+			/* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
+			MMIO_SET_BITS32(PortGpio_Base + PORT_DIGITAL_ENABLE_REG_OFFSET, Mask);
+		}
+		else if (Mode == PORT_ALTERNATE_FUNCTION_ADC_MODE)
+		{
+			/* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
+			MMIO_CLEAR_BITS32(PortGpio_Base + PORT_DIGITAL_ENABLE_REG_OFFSET, Mask);
+
+			/* Select the Alternative function for this pin (analog input) by set the corresponding bit in GPIOAFSEL register */
+			MMIO_SET_BITS32(PortGpio_Base + PORT_ALT_FUNC_REG_OFFSET, Mask);
+
+			/* Clear the PMCx bits for this pin */
+			MMIO_CLEAR_BITS32(PortGpio_Base + PORT_CTL_REG_OFFSET, (0x0000000FU << CtlShift));
+
+			/* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
+			MMIO_SET_BITS32(PortGpio_Base + PORT_ANALOG_MODE_SEL_REG_OFFSET, Mask);
+		}
+		else /* Another mode */
+		{
+			/* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
+			MMIO_CLEAR_BITS32(PortGpio_Base + PORT_ANALOG_MODE_SEL_REG_OFFSET, Mask);
+
+			/* Write the PMCx bits for this pin then enable its Alternative function in GPIOAFSEL register */
+			Port_WriteMasked(PortGpio_Base + PORT_CTL_REG_OFFSET, (0x0000000FU << CtlShift), PORT_CTL_ALL_PINS_MASK, ((uint32)Mode & 0x0000000FU) << CtlShift);
+			MMIO_SET_BITS32(PortGpio_Base + PORT_ALT_FUNC_REG_OFFSET, Mask);
+
+			/* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
+			MMIO_SET_BITS32(PortGpio_Base + PORT_DIGITAL_ENABLE_REG_OFFSET, Mask);
+		}
+	}
+	PORT_PROFILE_END(Port_Set_Pin_Mode_SID);
+}
+#endif
+
+/************************************************************************************
+* Service Name: Port_SetPinDirections
+* Service ID[hex]: 0x06
+* Sync/Async:   Synchronous
+* Reentrancy:   Reentrant
+* Parameters (in):      -Pins       -> Array of Port Pin ID numbers.
+                        -Directions -> Array of directions, Directions[i] is set on Pins[i].
+                        -NumberOfPins -> Number of elements in Pins and Directions.
+* Parameters (inout):   None
+* Parameters (out):     None
+* Return value:         None
+* Description: Function to set the direction of several port pins, the pins are grouped per
+*              port and GPIODIR of each port is written at most once. Nothing is written if
+*              any of the pins is rejected.
+************************************************************************************/
+#if (PORT_MULTI_PIN_API == STD_ON)
+void Port_SetPinDirections(const Port_PinType * Pins, const Port_PinDirectionType * Directions, uint8 NumberOfPins)
+{
+	boolean error = FALSE;
+	uint8 Index;
+	PORT_PROFILE_BEGIN();
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (Port_Status == PORT_NOT_INITIALIZED)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, Port_Set_Pin_Directions_SID, PORT_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if input pointers are not Null pointers */
+	else if ((NULL_PTR == Pins) || (NULL_PTR == Directions))
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, Port_Set_Pin_Directions_SID, PORT_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	else
+	{
+		/* Check that all the pins are valid and their direction is changeable */
+		for (Index = 0U; Index < NumberOfPins; Index++)
+		{
+			Port_PinType Pin = Pins[Index];
+
+			if (Pin >= PORT_CONFIGURED_PINS)
+			{
+				Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, Port_Set_Pin_Directions_SID, PORT_E_PARAM_PIN);
+				error = TRUE;
+			}
+			else if (!(Port_PinDb.DirChangeable[Port_PinDb.Port[Pin]] & Port_PinDb.Mask[Pin]))
+			{
+				Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, Port_Set_Pin_Directions_SID, PORT_E_DIRECTION_UNCHANGEABLE);
+				error = TRUE;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+	}
+#endif
+
+	/* In-case there are no errors */
+	if (FALSE == error)
+	{
+		uint8 PortNum;
+		/* Bits to be changed and their new values in each port */
+		uint8 ChangeMask[PORT_NUMBER_OF_PORTS] = {0U};
+		uint8 OutputMask[PORT_NUMBER_OF_PORTS] = {0U};
+
+		/* Coalesce the requested directions per port, the last direction of a repeated pin wins */
+		for (Index = 0U; Index < NumberOfPins; Index++)
+		{
+			Port_PinType Pin = Pins[Index];
+			uint8 PinPort = Port_PinDb.Port[Pin];
+			uint8 Mask = Port_PinDb.Mask[Pin] & (uint8)(~Port_PinDb.Protected[PinPort]);
+
+			if (Directions[Index] == PORT_PIN_OUT)
+			{
+				ChangeMask[PinPort] |= Mask;
+				OutputMask[PinPort] |= Mask;
+			}
+			else if (Directions[Index] == PORT_PIN_IN)
+			{
+				ChangeMask[PinPort] |= Mask;
+				OutputMask[PinPort] &= (uint8)(~Mask);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
 
-	switch(Port_ConfigPtr->Pins[Pin].Port_Num )
+		/* Commit each touched port with one GPIODIR update */
+		for (PortNum = 0U; PortNum < PORT_NUMBER_OF_PORTS; PortNum++)
+		{
+			if (0U != ChangeMask[PortNum])
+			{
+				Port_WriteMasked(Port_BaseAddress[PortNum] + PORT_DIR_REG_OFFSET, ChangeMask[PortNum], PORT_ALL_PINS_MASK, OutputMask[PortNum]);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+	}
+	else
 	{
-		case  0: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-		 break;
-		case  1: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-		 break;
-		case  2: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-		 break;
-		case  3: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-		 break;
-		case  4: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-		 break;
-		case  5: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-		 break;
+		/* No Action Required */
 	}
+	PORT_PROFILE_END(Port_Set_Pin_Directions_SID);
+}
+
+/************************************************************************************
+* Service Name: Port_SetPinModes
+* Service ID[hex]: 0x07
+* Sync/Async:   Synchronous
+* Reentrancy:   Reentrant
+* Parameters (in):      -Pins  -> Array of Port Pin ID numbers.
+                        -Modes -> Array of modes, Modes[i] is set on Pins[i].
+                        -NumberOfPins -> Number of elements in Pins and Modes.
+* Parameters (inout):   None
+* Parameters (out):     None
+* Return value:         None
+* Description: Function to set the mode of several port pins, the pins are grouped per port
+*              and GPIOPCTL, GPIOAFSEL, GPIOAMSEL and GPIODEN of each port are written at most
+*              once, in this order so no pin is ever driven by a function it was not given:
+*              - GPIOPCTL first: the pins entering an alternate function are not selected yet,
+*                the pins leaving one lose their function (not driven) until GPIOAFSEL.
+*              - GPIOAFSEL: the alternate pins take their new function, the DIO pins return to
+*                GPIO, the analog pins are left without a digital function.
+*              - GPIOAMSEL then GPIODEN: the analog switch and the digital buffer only change the
+*                input path of pins which are not driven by then.
+*              Nothing is written if any of the pins is rejected.
+************************************************************************************/
+void Port_SetPinModes(const Port_PinType * Pins, const Port_PinModeType * Modes, uint8 NumberOfPins)
+{
+	boolean error = FALSE;
+	uint8 Index;
+	PORT_PROFILE_BEGIN();
 
-	if( (Port_ConfigPtr->Pins[Pin].Port_Num == 2) && (Port_ConfigPtr->Pins[Pin].Pin_Num <= 3) ) /* PC0 to PC3 */
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (Port_Status == PORT_NOT_INITIALIZED)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, Port_Set_Pin_Modes_SID, PORT_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if input pointers are not Null pointers */
+	else if ((NULL_PTR == Pins) || (NULL_PTR == Modes))
 	{
-		/* Do Nothing ...  this is the JTAG pins */
-		return;
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, Port_Set_Pin_Modes_SID, PORT_E_PARAM_POINTER);
+		error = TRUE;
 	}
+	else
+	{
+		/* Check that all the pins and modes are valid and the pins mode is changeable */
+		for (Index = 0U; Index < NumberOfPins; Index++)
+		{
+			Port_PinType Pin = Pins[Index];
 
-	if (Mode == PORT_DIO_MODE)
+			if (Pin >= PORT_CONFIGURED_PINS)
+			{
+				Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, Port_Set_Pin_Modes_SID, PORT_E_PARAM_PIN);
+				error = TRUE;
+			}
+			else if (Modes[Index] > PORT_ALTERNATE_FUNCTION_ADC_MODE)
+			{
+				Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, Port_Set_Pin_Modes_SID, PORT_E_PARAM_INVALID_MODE);
+				error = TRUE;
+			}
+			else if (!(Port_PinDb.ModeChangeable[Port_PinDb.Port[Pin]] & Port_PinDb.Mask[Pin]))
+			{
+				Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, Port_Set_Pin_Modes_SID, PORT_E_MODE_UNCHANGEABLE);
+				error = TRUE;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+	}
+#endif
+
+	/* In-case there are no errors */
+	if (FALSE == error)
 	{
-		/* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-		CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_ConfigPtr->Pins[Pin].Pin_Num);
+		uint8 PortNum;
+		/* Pins to be changed in each port and the new content of their register bits */
+		uint8 ChangeMask[PORT_NUMBER_OF_PORTS] = {0U};
+		uint8 AltFunc[PORT_NUMBER_OF_PORTS] = {0U};
+		uint8 Analog[PORT_NUMBER_OF_PORTS] = {0U};
+		uint8 DigitalEnable[PORT_NUMBER_OF_PORTS] = {0U};
+		uint32 CtlMask[PORT_NUMBER_OF_PORTS] = {0U};
+		uint32 Ctl[PORT_NUMBER_OF_PORTS] = {0U};
+
+		/* Coalesce the requested modes per port, the last mode of a repeated pin wins */
+		for (Index = 0U; Index < NumberOfPins; Index++)
+		{
+			Port_PinType Pin = Pins[Index];
+			uint8 PinPort = Port_PinDb.Port[Pin];
+			uint8 Mask = Port_PinDb.Mask[Pin];
+			uint32 Field = 0x0000000FU << Port_PinDb.CtlShift[Pin];
+			Port_PinModeType Mode = Modes[Index];
 
-		/* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-		CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_ConfigPtr->Pins[Pin].Pin_Num);
+			/* The JTAG pins PC0 to PC3 are never changed */
+			if (!(Port_PinDb.Protected[PinPort] & Mask))
+			{
+				ChangeMask[PinPort]    |= Mask;
+				CtlMask[PinPort]       |= Field;
+				AltFunc[PinPort]       &= (uint8)(~Mask);
+				Analog[PinPort]        &= (uint8)(~Mask);
+				DigitalEnable[PinPort] &= (uint8)(~Mask);
+				Ctl[PinPort]           &= ~Field;
 
-		/* Clear the PMCx bits for this pin */
-		*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_ConfigPtr->Pins[Pin].Pin_Num * 4));
+				if (Mode == PORT_DIO_MODE)
+				{
+					DigitalEnable[PinPort] |= Mask;
+				}
+				else if (Mode == PORT_ALTERNATE_FUNCTION_ADC_MODE)
+				{
+					AltFunc[PinPort] |= Mask;
+					Analog[PinPort]  |= Mask;
+				}
+				else /* Another mode */
+				{
+					AltFunc[PinPort]       |= Mask;
+					DigitalEnable[PinPort] |= Mask;
+					Ctl[PinPort]           |= ((uint32)Mode & 0x0000000FU) << Port_PinDb.CtlShift[Pin];
+				}
+			}
+			else
+			{
+				/* Do Nothing ...  this is the JTAG pins */
+			}
+		}
+
+		/* Commit each touched port, each register once in the glitch free order */
+		for (PortNum = 0U; PortNum < PORT_NUMBER_OF_PORTS; PortNum++)
+		{
+			uint32 Base = Port_BaseAddress[PortNum];
 
-		/* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-		SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_ConfigPtr->Pins[Pin].Pin_Num);
+			if (0U != ChangeMask[PortNum])
+			{
+				Port_WriteMasked(Base + PORT_CTL_REG_OFFSET, CtlMask[PortNum], PORT_CTL_ALL_PINS_MASK, Ctl[PortNum]);
+				Port_WriteMasked(Base + PORT_ALT_FUNC_REG_OFFSET, ChangeMask[PortNum], PORT_ALL_PINS_MASK, AltFunc[PortNum]);
+				Port_WriteMasked(Base + PORT_ANALOG_MODE_SEL_REG_OFFSET, ChangeMask[PortNum], PORT_ALL_PINS_MASK, Analog[PortNum]);
+				Port_WriteMasked(Base + PORT_DIGITAL_ENABLE_REG_OFFSET, ChangeMask[PortNum], PORT_ALL_PINS_MASK, DigitalEnable[PortNum]);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
 	}
-	else if (Mode == PORT_ALTERNATE_FUNCTION_ADC_MODE)
+	else
 	{
-		/* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
-		CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_ConfigPtr->Pins[Pin].Pin_Num);
+		/* No Action Required */
+	}
+	PORT_PROFILE_END(Port_Set_Pin_Modes_SID);
+}
+#endif
 
-		/* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-		CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_ConfigPtr->Pins[Pin].Pin_Num);
+/************************************************************************************
+* Service Name: Port_SwitchPinMuxSet
+* Service ID[hex]: 0x08
+* Sync/Async:   Synchronous
+* Reentrancy:   Non Reentrant
+* Parameters (in):      -PinMuxSetId -> ID of the pin-mux set to switch to (PortConf_*_PIN_MUX_SET_ID).
+* Parameters (inout):   None
+* Parameters (out):     None
+* Return value:         Std_ReturnType - E_NOT_OK if the pin-mux set ID is invalid or the active
+*                       configuration is not one of the pin-mux sets.
+* Description: Function to move all the pins from the active pin-mux set to PinMuxSetId. The build time
+*              difference of the two pin-mux sets gives the bits to write, each register which differs
+*              is written once with the value of the target image in the order of Port_SetPinModes
+*              (GPIOPCTL, GPIOAFSEL, GPIOAMSEL) followed by the initial output levels before
+*              GPIODIR, the pulls and GPIODEN. The worst case is one read-modify-write of these
+*              eight registers per port, whatever the number of pins. Bits where the two pin-mux sets
+*              agree are not written, they keep any change made by Port_SetPinDirection/Mode. GPIOPCTL
+*              is written by whole PMCx fields and the pin database only has its changeable flags
+*              toggled, the pins are the same in all the pin-mux sets.
+************************************************************************************/
+#if (PORT_PINMUX_SET_API == STD_ON)
+Std_ReturnType Port_SwitchPinMuxSet(Port_PinMuxSetType PinMuxSetId)
+{
+	Std_ReturnType ret = E_NOT_OK;
+	boolean error = FALSE;
+	PORT_PROFILE_BEGIN();
 
-		/* Clear the PMCx bits for this pin */
-		*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_ConfigPtr->Pins[Pin].Pin_Num * 4));
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (Port_Status == PORT_NOT_INITIALIZED)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, Port_Switch_Pin_Mux_Set_SID, PORT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{	/* Do Nothing */	}
+#endif
 
-		/* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
-		SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_ConfigPtr->Pins[Pin].Pin_Num);
+	/* The target has to be a pin-mux set and the hardware has to hold a known pin-mux set to be diffed against */
+	if ((FALSE == error) && ((PinMuxSetId >= PORT_NUMBER_OF_PIN_MUX_SETS) || (Port_ActivePinMuxSet >= PORT_NUMBER_OF_PIN_MUX_SETS)))
+	{
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, Port_Switch_Pin_Mux_Set_SID, PORT_E_PARAM_PIN_MUX_SET);
+#endif
+		error = TRUE;
 	}
-	else /* Another mode */
+	else
+	{	/* Do Nothing */	}
+
+	/* In-case there are no errors */
+	if (FALSE == error)
 	{
-		/* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-		CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_ConfigPtr->Pins[Pin].Pin_Num);
+		if (PinMuxSetId != Port_ActivePinMuxSet)
+		{
+			const Port_ConfigType * Target = Port_PinMuxSets.Sets[PinMuxSetId];
+			const Port_RegisterDiffType * Diffs = (PinMuxSetId < Port_ActivePinMuxSet) ?
+				Port_PinMuxSets.Diffs[PORT_PIN_MUX_SET_DIFF_INDEX(PinMuxSetId, Port_ActivePinMuxSet)] :
+				Port_PinMuxSets.Diffs[PORT_PIN_MUX_SET_DIFF_INDEX(Port_ActivePinMuxSet, PinMuxSetId)];
+			uint8 PortNum;
 
-		/* Enable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-		SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_ConfigPtr->Pins[Pin].Pin_Num);
+			for (PortNum = 0U; PortNum < PORT_NUMBER_OF_PORTS; PortNum++)
+			{
+				const Port_RegisterDiffType * Diff = &Diffs[PortNum];
+				const Port_RegisterImageType * Image = &Target->Images[PortNum];
+				uint32 Base = Port_BaseAddress[PortNum];
+				uint8 DataMask = Diff->Data & Image->DataMask;
 
-		/* Set the PMCx bits for this pin */
-		*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (Mode & 0x0000000F << (Port_ConfigPtr->Pins[Pin].Pin_Num * 4));
+				if (Diff->Ctl != 0U)
+				{
+					Port_WriteMasked(Base + PORT_CTL_REG_OFFSET, Diff->Ctl, PORT_CTL_ALL_PINS_MASK, Image->Ctl);
+				}
+				if (Diff->AltFunc != 0U)
+				{
+					Port_WriteMasked(Base + PORT_ALT_FUNC_REG_OFFSET, Diff->AltFunc, PORT_ALL_PINS_MASK, Image->AltFunc);
+				}
+				if (Diff->Analog != 0U)
+				{
+					Port_WriteMasked(Base + PORT_ANALOG_MODE_SEL_REG_OFFSET, Diff->Analog, PORT_ALL_PINS_MASK, Image->Analog);
+				}
+				if (DataMask != 0U)
+				{
+					/* The GPIODATA address-mask aperture writes only the new DIO output levels, a plain store */
+					MMIO_WRITE32(Base + ((uint32)DataMask << 2), Image->Data);
+				}
+				if (Diff->Dir != 0U)
+				{
+					Port_WriteMasked(Base + PORT_DIR_REG_OFFSET, Diff->Dir, PORT_ALL_PINS_MASK, Image->Dir);
+				}
+				if (Diff->PullUp != 0U)
+				{
+					Port_WriteMasked(Base + PORT_PULL_UP_REG_OFFSET, Diff->PullUp, PORT_ALL_PINS_MASK, Image->PullUp);
+				}
+				if (Diff->PullDown != 0U)
+				{
+					Port_WriteMasked(Base + PORT_PULL_DOWN_REG_OFFSET, Diff->PullDown, PORT_ALL_PINS_MASK, Image->PullDown);
+				}
+				if (Diff->DigitalEnable != 0U)
+				{
+					Port_WriteMasked(Base + PORT_DIGITAL_ENABLE_REG_OFFSET, Diff->DigitalEnable, PORT_ALL_PINS_MASK, Image->DigitalEnable);
+				}
 
-		/* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-		SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_ConfigPtr->Pins[Pin].Pin_Num);
+				/* The pin-mux sets share the pins, only the changeable flags which differ are toggled */
+				Port_PinDb.DirChangeable[PortNum] ^= Diff->DirChangeable;
+				Port_PinDb.ModeChangeable[PortNum] ^= Diff->ModeChangeable;
+			}
+
+			/* The runtime services and Port_RefreshPortDirection follow the new pin-mux set */
+			Port_ConfigPtr = Target;
+			Port_ActivePinMuxSet = PinMuxSetId;
+		}
+		else
+		{
+			/* Already active, nothing to write */
+		}
+		ret = E_OK;
 	}
+	else
+	{
+		/* No Action Required */
+	}
+	PORT_PROFILE_END(Port_Switch_Pin_Mux_Set_SID);
+	return ret;
 }
 #endif
 
+/************************************************************************************
+* Service Name: Port_GetProfile
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ServiceId - ID of the Port service (Port_*_SID).
+* Parameters (inout): None
+* Parameters (out): Result - Count, min, max and mean duration of the service in cycles.
+* Return value: Std_ReturnType - E_NOT_OK if the service is not profiled or was never measured.
+* Description: Returns the cycle count statistics of a Port service.
+************************************************************************************/
+#if (PORT_PROFILING_API == STD_ON)
+Std_ReturnType Port_GetProfile(uint8 ServiceId, Profiling_ResultType * Result)
+{
+  Std_ReturnType ret = E_NOT_OK;
+  
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+  /* check if the output pointer is not a NULL_PTR */
+  if(Result == NULL_PTR)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, Port_Get_Profile_SID, PORT_E_PARAM_POINTER);
+  }
+  else
+  #endif
+  if(ServiceId < PORT_PROFILING_SIDS)
+  {
+    ret = Profiling_GetResult(&Port_Profile[ServiceId], Result);
+  }
+  else
+  {	
+    /* Do Nothing */	
+  }
+  return ret;
+}
+#endif
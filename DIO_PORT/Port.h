@@ -74,6 +74,9 @@
 
 /* Non AUTOSAR files */
 #include "Common_Macros.h"
+#if (PORT_PROFILING_API == STD_ON)
+#include "Profiling.h"
+#endif
 
 /******************************************************************************
  *                      API Service Id Macros                                 *
@@ -93,6 +96,21 @@
 /*Service ID Setting the Port pin mode*/
 #define Port_Set_Pin_Mode_SID                   (uint8)0x04
 
+/*Service ID for Port get profile function (Not exist in AUTOSAR 4.0.3 PORT SWS Document)*/
+#define Port_Get_Profile_SID                    (uint8)0x05
+
+/*Service ID for Setting the direction of several port pins (Not exist in AUTOSAR 4.0.3 PORT SWS Document)*/
+#define Port_Set_Pin_Directions_SID             (uint8)0x06
+
+/*Service ID for Setting the mode of several port pins (Not exist in AUTOSAR 4.0.3 PORT SWS Document)*/
+#define Port_Set_Pin_Modes_SID                  (uint8)0x07
+
+/*Service ID for Switching the pin-mux set (Not exist in AUTOSAR 4.0.3 PORT SWS Document)*/
+#define Port_Switch_Pin_Mux_Set_SID             (uint8)0x08
+
+/*Number of profiled service IDs, the profiled services have IDs below PORT_PROFILING_SIDS*/
+#define PORT_PROFILING_SIDS                     (9U)
+
 /*******************************************************************************
  *                      DET Error Codes                                        *
  *******************************************************************************/
@@ -118,6 +136,12 @@
 /*DET error for:API Port_GetVersionInfo called with a Null Pointer*/ 
 #define PORT_E_PARAM_POINTER                 (uint8)0x10
 
+/*DET error for: Port_SwitchPinMuxSet called with an invalid pin-mux set ID or while the active configuration is not a pin-mux set*/
+#define PORT_E_PARAM_PIN_MUX_SET             (uint8)0x11
+
+/*DET error for: Port_Init gave up waiting for a clocked port to report ready in PRGPIO*/
+#define PORT_E_CLOCK_NOT_READY               (uint8)0x12
+
 /*******************************************************************************
  *                              Module Data Types                              *
  *******************************************************************************/
@@ -162,15 +186,26 @@ typedef enum
    Pin_mode_changeable_OFF
 }Pin_mode_changeable;
   
+/* Description: Enum to choose the edge interrupt of the pin */
+typedef enum
+{
+   PORT_PIN_INTERRUPT_OFF,        /* No interrupt */
+   PORT_PIN_INTERRUPT_RISING,     /* Interrupt on rising edges */
+   PORT_PIN_INTERRUPT_FALLING,    /* Interrupt on falling edges */
+   PORT_PIN_INTERRUPT_BOTH        /* Interrupt on both edges */
+}Port_PinInterruptType;
+
 /* Description: Structure to configure each individual PIN:
  *	1. the PORT Which the pin belongs to. 0, 1, 2, 3, 4 or 5
  *	2. the number of the pin in the PORT.
  *      3. the pin mode in the port, GPIO or other Alternative mode.
  *      4. the direction of pin --> INPUT or OUTPUT
- *      5. the initial value of the pin -> STD_HIGH / STD_LOW
- *      6. the status of the pin direction changeability -> STD_ON/STD_OFF
- *      7. the status of the pin mode changeability -> STD_ON/STD_OFF
- *      8. the internal resistor --> Disable, Pull up or Pull down
+ *      5. the status of the pin direction changeability -> STD_ON/STD_OFF
+ *      6. the internal resistor --> Disable, Pull up or Pull down
+ *      7. the initial value of the pin -> STD_HIGH / STD_LOW
+ *      8. the status of the pin mode changeability -> STD_ON/STD_OFF
+ *      9. the edge interrupt --> Off, Rising, Falling or Both edges
+ *  in the order of the Port_PBcfg.c rows.
  */
 typedef struct
 {
@@ -185,7 +220,6 @@ typedef struct
    Description: Possible directions of a port pin.
  */
   Port_PinDirectionType         Pin_Direction;
-  uint8                         Pin_initial_value;
   
   /*
    Name: Pin_direction_changeable
@@ -194,6 +228,14 @@ typedef struct
    Description: Possible of changing pin direction during the runtime or not.
  */
   Pin_direction_changeable      Pin_direction_change;
+   /*
+   Name: Port_InternalResistor
+   Type: Enumeration
+   Range: OFF,PULL_UP,PULL_DOWN
+   Description: To hold internal resistor type for PIN .
+ */
+  Port_InternalResistor        resistor;
+  uint8                         Pin_initial_value;
    /*
    Name: Pin_mode_changeable
    Type: Enumeration
@@ -202,19 +244,217 @@ typedef struct
  */
   Pin_mode_changeable           Pin_modeChange;
    /*
-   Name: Port_InternalResistor
+   Name: Port_PinInterruptType
    Type: Enumeration
-   Range: OFF,PULL_UP,PULL_DOWN
-   Description: To hold internal resistor type for PIN .
+   Range: PORT_PIN_INTERRUPT_OFF, PORT_PIN_INTERRUPT_RISING, PORT_PIN_INTERRUPT_FALLING & PORT_PIN_INTERRUPT_BOTH
+   Description: Edge interrupt of the PIN, the events are captured by the Dio capture ring.
  */
-  Port_InternalResistor        resistor;
+  Port_PinInterruptType         Pin_interrupt;
 }Port_ConfigPin;
 
+/* Description: Register image of one GPIO port folded from the pins configured in it.
+ * Port_Init writes only the Pins bits of each register, the other pins keep their value. */
+typedef struct
+{
+  uint32 Ctl;            /* GPIOPCTL PMCx fields */
+  uint8  Pins;           /* Configured pins of the port */
+  uint8  Commit;         /* Locked pins committed in GPIOCR before the configuration */
+  uint8  Analog;         /* GPIOAMSEL */
+  uint8  AltFunc;        /* GPIOAFSEL */
+  uint8  DataMask;       /* DIO output pins driven with their initial value */
+  uint8  Data;           /* Initial value of the DIO output pins */
+  uint8  Dir;            /* GPIODIR */
+  uint8  RefreshMask;    /* Pins with a direction not changeable at runtime, restored by Port_RefreshPortDirection */
+  uint8  PullUp;         /* GPIOPUR */
+  uint8  PullDown;       /* GPIOPDR */
+  uint8  DigitalEnable;  /* GPIODEN */
+  uint8  IntPins;        /* Pins with an edge interrupt */
+  uint8  IntBothEdges;   /* GPIOIBE */
+  uint8  IntEvent;       /* GPIOIEV */
+  uint8  Jtag;           /* JTAG pins listed in the configuration, never written */
+}Port_RegisterImageType;
+
 /*Data structure required to initialize the Port driver*/
 typedef struct
 {
   Port_ConfigPin Pins[PORT_CONFIGURED_PINS];
+  /* Register images of the ports, generated at build time from the same rows as Pins */
+  Port_RegisterImageType Images[PORT_NUMBER_OF_PORTS];
 }Port_ConfigType;
+
+/* Description: Runtime pin database built by Port_Init from the configuration set, one table per
+ * attribute indexed by the Port Pin ID so a runtime service resolves a pin with a couple of table
+ * loads instead of walking the Pins rows. */
+typedef struct
+{
+  uint32 Base[PORT_CONFIGURED_PINS];            /* Registers base address of the port of each pin */
+  uint8  Port[PORT_CONFIGURED_PINS];            /* Port of each pin */
+  uint8  Mask[PORT_CONFIGURED_PINS];            /* Bit of each pin in its port registers */
+  uint8  CtlShift[PORT_CONFIGURED_PINS];        /* Position of the PMCx field of each pin in GPIOPCTL */
+  uint8  Protected[PORT_NUMBER_OF_PORTS];       /* JTAG pins, never written by the runtime services */
+  uint8  DirChangeable[PORT_NUMBER_OF_PORTS];   /* Pins with a direction changeable at runtime */
+  uint8  ModeChangeable[PORT_NUMBER_OF_PORTS];  /* Pins with a mode changeable at runtime */
+}Port_PinDatabaseType;
+
+/*******************************************************************************
+ *                  Post-build Register Image Generation                       *
+ *******************************************************************************/
+/* A configuration lists its pins once as an X-macro LIST(ROW, ARG) calling
+ * ROW(ARG, Port, Pin, Mode, Direction, DirChangeable, Resistor, InitialValue, ModeChangeable, Interrupt)
+ * per pin. PORT_CONFIG_PIN expands it to the Pins rows and PORT_IMAGE(LIST, Port) to the
+ * register image of one port, both are constant expressions evaluated by the compiler. */
+
+/* Symbolic ID of the first pin of a port */
+#define PORT_FIRST_PIN_ID(PORT_NUM) \
+  (((PORT_NUM) == PORT_A) ? PORTA_PA0 : ((PORT_NUM) == PORT_B) ? PORTB_PB0 : \
+   ((PORT_NUM) == PORT_C) ? PORTC_PC0 : ((PORT_NUM) == PORT_D) ? PORTD_PD0 : \
+   ((PORT_NUM) == PORT_E) ? PORTE_PE0 : PORTF_PF0)
+
+/* Bit of a pin in its port registers */
+#define PORT_PIN_BIT(PORT_NUM, PIN_ID)       ((uint32)(PIN_ID) - (uint32)PORT_FIRST_PIN_ID(PORT_NUM))
+
+#define PORT_IS_JTAG_PIN(PIN_ID) \
+  (((PIN_ID) == JTAG_PIN1) || ((PIN_ID) == JTAG_PIN2) || ((PIN_ID) == JTAG_PIN3) || ((PIN_ID) == JTAG_PIN4))
+
+#define PORT_IS_NMI_PIN(PIN_ID)              (((PIN_ID) == NMI_PIN1) || ((PIN_ID) == NMI_PIN2))
+
+/* Pin bit in the image of port IMAGE_PORT when the row belongs to it, is not a JTAG pin and COND holds */
+#define PORT_IMAGE_BIT(IMAGE_PORT, PORT_NUM, PIN_ID, COND) \
+  ((((IMAGE_PORT) == (PORT_NUM)) && !PORT_IS_JTAG_PIN(PIN_ID) && (COND)) ? (1UL << PORT_PIN_BIT(PORT_NUM, PIN_ID)) : 0UL)
+
+/* Row of the Pins table */
+#define PORT_CONFIG_PIN(ARG, PORT_NUM, PIN_ID, MODE, DIR, DIR_CHANGE, RES, INIT, MODE_CHANGE, INT) \
+  {PORT_NUM, PIN_ID, MODE, DIR, DIR_CHANGE, RES, INIT, MODE_CHANGE, INT},
+
+/* Contribution of a row to each field of the image of port IMG, same rules as the pin by pin configuration:
+ * analog pins are alternate function without digital enable and pulls, the other alternate modes select
+ * their PMCx field and the DIO outputs are driven with their initial value before the direction is set */
+#define PORT_IMAGE_CTL(IMG, P, PIN, MODE, DIR, DCH, RES, INIT, MCH, INT) \
+  | ((((IMG) == (P)) && !PORT_IS_JTAG_PIN(PIN) && ((MODE) != PORT_DIO_MODE) && ((MODE) != PORT_ALTERNATE_FUNCTION_ADC_MODE)) ? \
+     (((uint32)(MODE) & 0x0000000FUL) << (PORT_PIN_BIT(P, PIN) * 4UL)) : 0UL)
+#define PORT_IMAGE_PINS(IMG, P, PIN, MODE, DIR, DCH, RES, INIT, MCH, INT) \
+  | PORT_IMAGE_BIT(IMG, P, PIN, TRUE)
+#define PORT_IMAGE_COMMIT(IMG, P, PIN, MODE, DIR, DCH, RES, INIT, MCH, INT) \
+  | PORT_IMAGE_BIT(IMG, P, PIN, PORT_IS_NMI_PIN(PIN))
+#define PORT_IMAGE_ANALOG(IMG, P, PIN, MODE, DIR, DCH, RES, INIT, MCH, INT) \
+  | PORT_IMAGE_BIT(IMG, P, PIN, (MODE) == PORT_ALTERNATE_FUNCTION_ADC_MODE)
+#define PORT_IMAGE_ALT_FUNC(IMG, P, PIN, MODE, DIR, DCH, RES, INIT, MCH, INT) \
+  | PORT_IMAGE_BIT(IMG, P, PIN, (MODE) != PORT_DIO_MODE)
+#define PORT_IMAGE_DATA_MASK(IMG, P, PIN, MODE, DIR, DCH, RES, INIT, MCH, INT) \
+  | PORT_IMAGE_BIT(IMG, P, PIN, ((MODE) == PORT_DIO_MODE) && ((DIR) == PORT_PIN_OUT))
+#define PORT_IMAGE_DATA(IMG, P, PIN, MODE, DIR, DCH, RES, INIT, MCH, INT) \
+  | PORT_IMAGE_BIT(IMG, P, PIN, ((MODE) == PORT_DIO_MODE) && ((DIR) == PORT_PIN_OUT) && ((INIT) == STD_HIGH))
+#define PORT_IMAGE_DIR(IMG, P, PIN, MODE, DIR, DCH, RES, INIT, MCH, INT) \
+  | PORT_IMAGE_BIT(IMG, P, PIN, (DIR) == PORT_PIN_OUT)
+#define PORT_IMAGE_REFRESH_MASK(IMG, P, PIN, MODE, DIR, DCH, RES, INIT, MCH, INT) \
+  | PORT_IMAGE_BIT(IMG, P, PIN, (DCH) == Pin_direction_changeable_OFF)
+#define PORT_IMAGE_PULL_UP(IMG, P, PIN, MODE, DIR, DCH, RES, INIT, MCH, INT) \
+  | PORT_IMAGE_BIT(IMG, P, PIN, ((MODE) != PORT_ALTERNATE_FUNCTION_ADC_MODE) && ((RES) == PULL_UP))
+#define PORT_IMAGE_PULL_DOWN(IMG, P, PIN, MODE, DIR, DCH, RES, INIT, MCH, INT) \
+  | PORT_IMAGE_BIT(IMG, P, PIN, ((MODE) != PORT_ALTERNATE_FUNCTION_ADC_MODE) && ((RES) == PULL_DOWN))
+#define PORT_IMAGE_DIGITAL_ENABLE(IMG, P, PIN, MODE, DIR, DCH, RES, INIT, MCH, INT) \
+  | PORT_IMAGE_BIT(IMG, P, PIN, (MODE) != PORT_ALTERNATE_FUNCTION_ADC_MODE)
+#define PORT_IMAGE_INT_PINS(IMG, P, PIN, MODE, DIR, DCH, RES, INIT, MCH, INT) \
+  | PORT_IMAGE_BIT(IMG, P, PIN, (INT) != PORT_PIN_INTERRUPT_OFF)
+#define PORT_IMAGE_INT_BOTH_EDGES(IMG, P, PIN, MODE, DIR, DCH, RES, INIT, MCH, INT) \
+  | PORT_IMAGE_BIT(IMG, P, PIN, (INT) == PORT_PIN_INTERRUPT_BOTH)
+#define PORT_IMAGE_INT_EVENT(IMG, P, PIN, MODE, DIR, DCH, RES, INIT, MCH, INT) \
+  | PORT_IMAGE_BIT(IMG, P, PIN, (INT) == PORT_PIN_INTERRUPT_RISING)
+#define PORT_IMAGE_JTAG(IMG, P, PIN, MODE, DIR, DCH, RES, INIT, MCH, INT) \
+  | ((((IMG) == (P)) && PORT_IS_JTAG_PIN(PIN)) ? (1UL << PORT_PIN_BIT(P, PIN)) : 0UL)
+
+/* Pins of the runtime pin database (Port_PinDatabaseType), the JTAG pins included */
+#define PORT_IMAGE_DIR_CHANGEABLE(IMG, P, PIN, MODE, DIR, DCH, RES, INIT, MCH, INT) \
+  | ((((IMG) == (P)) && ((DCH) == Pin_direction_changeable_ON)) ? (1UL << PORT_PIN_BIT(P, PIN)) : 0UL)
+#define PORT_IMAGE_MODE_CHANGEABLE(IMG, P, PIN, MODE, DIR, DCH, RES, INIT, MCH, INT) \
+  | ((((IMG) == (P)) && ((MCH) == Pin_mode_changeable_ON)) ? (1UL << PORT_PIN_BIT(P, PIN)) : 0UL)
+
+/* Register image of port PORT_NUM in the field order of Port_RegisterImageType */
+#define PORT_IMAGE(LIST, PORT_NUM) \
+  { (uint32)(0UL LIST(PORT_IMAGE_CTL, PORT_NUM)),            (uint8)(0UL LIST(PORT_IMAGE_PINS, PORT_NUM)), \
+    (uint8)(0UL LIST(PORT_IMAGE_COMMIT, PORT_NUM)),          (uint8)(0UL LIST(PORT_IMAGE_ANALOG, PORT_NUM)), \
+    (uint8)(0UL LIST(PORT_IMAGE_ALT_FUNC, PORT_NUM)),        (uint8)(0UL LIST(PORT_IMAGE_DATA_MASK, PORT_NUM)), \
+    (uint8)(0UL LIST(PORT_IMAGE_DATA, PORT_NUM)),            (uint8)(0UL LIST(PORT_IMAGE_DIR, PORT_NUM)), \
+    (uint8)(0UL LIST(PORT_IMAGE_REFRESH_MASK, PORT_NUM)),    (uint8)(0UL LIST(PORT_IMAGE_PULL_UP, PORT_NUM)), \
+    (uint8)(0UL LIST(PORT_IMAGE_PULL_DOWN, PORT_NUM)),       (uint8)(0UL LIST(PORT_IMAGE_DIGITAL_ENABLE, PORT_NUM)), \
+    (uint8)(0UL LIST(PORT_IMAGE_INT_PINS, PORT_NUM)),        (uint8)(0UL LIST(PORT_IMAGE_INT_BOTH_EDGES, PORT_NUM)), \
+    (uint8)(0UL LIST(PORT_IMAGE_INT_EVENT, PORT_NUM)),       (uint8)(0UL LIST(PORT_IMAGE_JTAG, PORT_NUM)) }
+
+/* Images of all the ports, initializer of Port_ConfigType.Images */
+#define PORT_IMAGES(LIST) \
+  { PORT_IMAGE(LIST, PORT_A), PORT_IMAGE(LIST, PORT_B), PORT_IMAGE(LIST, PORT_C), \
+    PORT_IMAGE(LIST, PORT_D), PORT_IMAGE(LIST, PORT_E), PORT_IMAGE(LIST, PORT_F) }
+
+#if (PORT_PINMUX_SET_API == STD_ON)
+
+#if (PORT_NUMBER_OF_PIN_MUX_SETS < 2U)
+  #error "Port_SwitchPinMuxSet needs at least two pin-mux sets"
+#endif
+
+/* Type definition for the ID of a pin-mux set (PortConf_*_PIN_MUX_SET_ID) */
+typedef uint8 Port_PinMuxSetType;
+
+/* Description: Bits of the registers of one port which differ between two pin-mux sets. The
+ * difference is symmetric, the values written are the ones of the target pin-mux set image. */
+typedef struct
+{
+  uint32 Ctl;            /* GPIOPCTL, whole PMCx fields of the pins whose field differs */
+  uint8  Analog;         /* GPIOAMSEL */
+  uint8  AltFunc;        /* GPIOAFSEL */
+  uint8  Data;           /* DIO output pins whose initial level or output role differs */
+  uint8  Dir;            /* GPIODIR */
+  uint8  PullUp;         /* GPIOPUR */
+  uint8  PullDown;       /* GPIOPDR */
+  uint8  DigitalEnable;  /* GPIODEN */
+  uint8  DirChangeable;  /* Port_PinDatabaseType.DirChangeable */
+  uint8  ModeChangeable; /* Port_PinDatabaseType.ModeChangeable */
+}Port_RegisterDiffType;
+
+/* Number of pin-mux set pairs, one difference per pair (a, b) with a < b */
+#define PORT_NUMBER_OF_PIN_MUX_SET_DIFFS     ((PORT_NUMBER_OF_PIN_MUX_SETS * (PORT_NUMBER_OF_PIN_MUX_SETS - 1U)) / 2U)
+
+/* Index of the difference of the pin-mux sets A < B in Port_PinMuxSetsType.Diffs */
+#define PORT_PIN_MUX_SET_DIFF_INDEX(A, B)    ((((A) * ((2U * PORT_NUMBER_OF_PIN_MUX_SETS) - (A) - 1U)) / 2U) + ((B) - (A) - 1U))
+
+/* Description: Pin-mux sets generated at build time with the differences of every pair */
+typedef struct
+{
+  const Port_ConfigType * Sets[PORT_NUMBER_OF_PIN_MUX_SETS];
+  Port_RegisterDiffType Diffs[PORT_NUMBER_OF_PIN_MUX_SET_DIFFS][PORT_NUMBER_OF_PORTS];
+}Port_PinMuxSetsType;
+
+/* Value of one image field of port PORT_NUM generated from LIST */
+#define PORT_IMAGE_FIELD(LIST, FIELD, PORT_NUM)    (0UL LIST(FIELD, PORT_NUM))
+
+/* Bits of one image field of port PORT_NUM which differ between the lists A and B */
+#define PORT_DIFF_FIELD(A, B, FIELD, PORT_NUM) \
+  (PORT_IMAGE_FIELD(A, FIELD, PORT_NUM) ^ PORT_IMAGE_FIELD(B, FIELD, PORT_NUM))
+
+/* Widen the differing bits of a GPIOPCTL value to whole PMCx fields, so a field changed at runtime
+ * by Port_SetPinMode is written with the full target value and not mixed with it */
+#define PORT_CTL_FIELDS(BITS) \
+  (((((BITS) | ((BITS) >> 1) | ((BITS) >> 2) | ((BITS) >> 3)) & 0x11111111UL)) * 0xFUL)
+
+/* Difference of port PORT_NUM between the lists A and B in the field order of Port_RegisterDiffType */
+#define PORT_IMAGE_DIFF(A, B, PORT_NUM) \
+  { (uint32)PORT_CTL_FIELDS(PORT_DIFF_FIELD(A, B, PORT_IMAGE_CTL, PORT_NUM)), \
+    (uint8)PORT_DIFF_FIELD(A, B, PORT_IMAGE_ANALOG, PORT_NUM), \
+    (uint8)PORT_DIFF_FIELD(A, B, PORT_IMAGE_ALT_FUNC, PORT_NUM), \
+    (uint8)(PORT_DIFF_FIELD(A, B, PORT_IMAGE_DATA_MASK, PORT_NUM) | PORT_DIFF_FIELD(A, B, PORT_IMAGE_DATA, PORT_NUM)), \
+    (uint8)PORT_DIFF_FIELD(A, B, PORT_IMAGE_DIR, PORT_NUM), \
+    (uint8)PORT_DIFF_FIELD(A, B, PORT_IMAGE_PULL_UP, PORT_NUM), \
+    (uint8)PORT_DIFF_FIELD(A, B, PORT_IMAGE_PULL_DOWN, PORT_NUM), \
+    (uint8)PORT_DIFF_FIELD(A, B, PORT_IMAGE_DIGITAL_ENABLE, PORT_NUM), \
+    (uint8)PORT_DIFF_FIELD(A, B, PORT_IMAGE_DIR_CHANGEABLE, PORT_NUM), \
+    (uint8)PORT_DIFF_FIELD(A, B, PORT_IMAGE_MODE_CHANGEABLE, PORT_NUM) }
+
+/* Differences of all the ports, one row of Port_PinMuxSetsType.Diffs */
+#define PORT_IMAGE_DIFFS(A, B) \
+  { PORT_IMAGE_DIFF(A, B, PORT_A), PORT_IMAGE_DIFF(A, B, PORT_B), PORT_IMAGE_DIFF(A, B, PORT_C), \
+    PORT_IMAGE_DIFF(A, B, PORT_D), PORT_IMAGE_DIFF(A, B, PORT_E), PORT_IMAGE_DIFF(A, B, PORT_F) }
+
+#endif
+
  
 /*******************************************************************************
  *                      Function Prototypes                                    *
@@ -235,7 +475,7 @@ typedef struct
 ************************************************************************************/
 void Port_Init( const Port_ConfigType* ConfigPtr );
 
-#if (Port_Set_Pin_Direction_Api == STD_ON)
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
 
 /************************************************************************************
 * Service Name: Port_SetPinDirection
@@ -306,12 +546,87 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode );
 
 #endif
 
+#if (PORT_MULTI_PIN_API == STD_ON)
+
+/************************************************************************************
+* Service Name: Port_SetPinDirections
+* Sync/Async:   Synchronous
+* Reentrancy:   Reentrant
+* Parameters (in):      -Pins       -> Array of Port Pin ID numbers.
+                        -Directions -> Array of directions, Directions[i] is set on Pins[i].
+                        -NumberOfPins -> Number of elements in Pins and Directions.
+* Parameters (inout):   None
+* Parameters (out):     None
+* Return value:         None
+* Description: Function to set the direction of several port pins during runtime, GPIODIR
+*              of each port is written at most once.
+************************************************************************************/
+void Port_SetPinDirections(const Port_PinType * Pins, const Port_PinDirectionType * Directions, uint8 NumberOfPins);
+
+/************************************************************************************
+* Service Name: Port_SetPinModes
+* Sync/Async:   Synchronous
+* Reentrancy:   Reentrant
+* Parameters (in):      -Pins  -> Array of Port Pin ID numbers.
+                        -Modes -> Array of modes, Modes[i] is set on Pins[i].
+                        -NumberOfPins -> Number of elements in Pins and Modes.
+* Parameters (inout):   None
+* Parameters (out):     None
+* Return value:         None
+* Description: Function to set the mode of several port pins during runtime, GPIOPCTL,
+*              GPIOAFSEL, GPIOAMSEL and GPIODEN of each port are written at most once.
+************************************************************************************/
+void Port_SetPinModes(const Port_PinType * Pins, const Port_PinModeType * Modes, uint8 NumberOfPins);
+
+#endif
+
+#if (PORT_PINMUX_SET_API == STD_ON)
+
+/************************************************************************************
+* Service Name: Port_SwitchPinMuxSet
+* Sync/Async:   Synchronous
+* Reentrancy:   Non Reentrant
+* Parameters (in):      -PinMuxSetId -> ID of the pin-mux set to switch to (PortConf_*_PIN_MUX_SET_ID).
+* Parameters (inout):   None
+* Parameters (out):     None
+* Return value:         Std_ReturnType - E_NOT_OK if the pin-mux set ID is invalid or the active
+*                       configuration is not one of the pin-mux sets.
+* Description: Function to move all the pins from the active pin-mux set to PinMuxSetId, only the
+*              register bits which differ between the two pin-mux sets are written.
+************************************************************************************/
+Std_ReturnType Port_SwitchPinMuxSet(Port_PinMuxSetType PinMuxSetId);
+
+#endif
+
+#if (PORT_PROFILING_API == STD_ON)
+
+/************************************************************************************
+* Service Name: Port_GetProfile
+* Sync/Async:   Synchronous
+* Reentrancy:   Reentrant
+* Parameters (in):      ServiceId -> ID of the Port service (Port_*_SID).
+* Parameters (inout):   None
+* Parameters (out):     Result -> Count, min, max and mean duration of the service in cycles.
+* Return value:         Std_ReturnType -> E_NOT_OK if the service was never measured.
+* Description: Function to return the cycle count statistics of a Port service.
+************************************************************************************/
+Std_ReturnType Port_GetProfile(uint8 ServiceId, Profiling_ResultType * Result);
+
+#endif
+
 /*******************************************************************************
  *                       External Variables                                    *
  *******************************************************************************/
 
 /* Extern PB structures to be used by Dio and other modules */
-extern const Port_ConfigType PORT_B_Configuration;
+extern const Port_ConfigType Port_Configuration;
+
+#if (PORT_PINMUX_SET_API == STD_ON)
+/* Extern PB structures of the other pin-mux sets and of the table of pin-mux sets */
+extern const Port_ConfigType Port_Uart0Configuration;
+extern const Port_ConfigType Port_Ssi0Configuration;
+extern const Port_PinMuxSetsType Port_PinMuxSets;
+#endif
 
 
 #endif /* PORT_H */
@@ -37,6 +37,32 @@
 /* Pre-compile option to enable/disable the use of Port_SetPinMode function */
 #define PORT_SET_PIN_MODE_API                   (STD_ON)
 
+/* Pre-compile option for presence of Port_SetPinDirections/Port_SetPinModes APIs */
+#define PORT_MULTI_PIN_API                      (STD_ON)
+
+/* Pre-compile option for presence of the pin-mux sets and Port_SwitchPinMuxSet API */
+#define PORT_PINMUX_SET_API                     (STD_ON)
+
+/* Pre-compile option for the cycle count profiling of the Port services (Port_GetProfile),
+ * the host tests also build the drivers with it on */
+#ifndef PORT_PROFILING_API
+#define PORT_PROFILING_API                      (STD_OFF)
+#endif
+
+/*
+ * Pre-compile option selecting the GPIO ports accessed through the AHB aperture:
+ * bit n set --> port n (0 --> PORTA ... 5 --> PORTF) uses AHB (back-to-back single cycle access),
+ * bit n cleared --> port n uses the legacy APB aperture.
+ * Dio_Cfg.h takes DIO_GPIO_AHB_PORTS_MASK from it. The host tests also build the drivers
+ * with all the ports on APB.
+ */
+#ifndef PORT_GPIO_AHB_PORTS_MASK
+#define PORT_GPIO_AHB_PORTS_MASK                (0x3FU)
+#endif
+
+/* Maximum number of PRGPIO reads Port_Init waits for the clocked ports to report ready */
+#define PORT_CLOCK_READY_POLLS                  (100U)
+
 /* Number of the configured Port Channels */
 #define PORT_CONFIGURED_PINS                    (43U) //39 channels plus the JTAG pins
 
@@ -77,6 +103,8 @@
       #define PORT_PIN_DEFAULT_MODE_CHANGEABLE           (Pin_mode_changeable_OFF)
 
       #define PORT_PIN_DEFAULT_INTERNAL_RESISTOR         (OFF)
+      
+      #define PORT_PIN_DEFAULT_INTERRUPT                 (PORT_PIN_INTERRUPT_OFF)
 
  /*******************************************************************************
  *                            2.PORTs Indices                                   *
@@ -87,6 +115,9 @@
       #define PORT_D                            (3U)
       #define PORT_E                            (4U)
       #define PORT_F                            (5U) 
+
+      /* Number of GPIO ports */
+      #define PORT_NUMBER_OF_PORTS              (6U)
    
  /*******************************************************************************
  *                              3.PortA Pins                                   *
@@ -167,5 +198,16 @@
       #define NMI_PIN1                        PORTF_PF0
       #define NMI_PIN2                        PORTD_PD7
 
+ /*******************************************************************************
+ *                               10.Pin-mux Sets                               *
+ *******************************************************************************/
+   /* Pin-mux sets of Port_PBcfg.c, Port_SwitchPinMuxSet moves the pins from the active pin-mux set to another one */
+      #define PortConf_DEFAULT_PIN_MUX_SET_ID (0U) /* Port_Configuration: all the free pins are DIO */
+      #define PortConf_UART0_PIN_MUX_SET_ID   (1U) /* Port_Uart0Configuration: PA0/PA1 are U0RX/U0TX */
+      #define PortConf_SSI0_PIN_MUX_SET_ID    (2U) /* Port_Ssi0Configuration: PA2-PA5 are SSI0 CLK/FSS/RX/TX */
+
+      /* Number of pin-mux sets */
+      #define PORT_NUMBER_OF_PIN_MUX_SETS     (3U)
+
 
 #endif
\ No newline at end of file
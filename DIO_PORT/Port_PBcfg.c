@@ -40,7 +40,7 @@
   #error "The SW version of PBcfg.c does not match the expected version"
 #endif
    
- /*Structure for the multiple configuration options, including the following parameters -respectively-:
+ /*Pins of the configuration, one ROW per pin with the following parameters -respectively-:
          1- Port name
          2- Port pin number
          3- Pin mode
@@ -49,56 +49,157 @@
          6- Pin internal resistor
          7- Pin initial value
          8- Pin mode changeable 
+         9- Pin edge interrupt
+   The list is expanded twice, to the Pins table and to the register images of the ports (see Port.h).
+   The pin-mux sets share the rows, a column which differs between pin-mux sets selects its value
+   from the SET argument: the pin mode, and the changeable flags of the pins which stay under the
+   control of the application in the pin-mux set which uses them (U0RX/U0TX may be turned back to
+   DIO). The other pin-mux sets keep the defaults.
    */
-  const Port_ConfigType Port_Configuration= {
-                                                      /*****************************PORT A**************************/ 
-	 PORT_A,PORTA_PA0,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_A,PORTA_PA1,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_A,PORTA_PA2,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_A,PORTA_PA3,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_A,PORTA_PA4,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_A,PORTA_PA5,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_A,PORTA_PA6,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_A,PORTA_PA7,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-                                                      /*****************************PORT B**************************/ 
-         PORT_B,PORTB_PB0,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_B,PORTB_PB1,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_B,PORTB_PB2,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_B,PORTB_PB3,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_B,PORTB_PB4,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_B,PORTB_PB5,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_B,PORTB_PB6,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_B,PORTB_PB7,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-                                                      /**************************PORT C*************************/
-	 PORT_C,PORTC_PC0,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_C,PORTC_PC1,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_C,PORTC_PC2,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_C,PORTC_PC3,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_C,PORTC_PC4,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_C,PORTC_PC5,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_C,PORTC_PC6,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_C,PORTC_PC7,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-                                                      /*******************PORT D**********************/ 
-         PORT_D,PORTD_PD0,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_D,PORTD_PD1,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_D,PORTD_PD2,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_D,PORTD_PD3,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_D,PORTD_PD4,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_D,PORTD_PD5,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_D,PORTD_PD6,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_D,PORTD_PD7,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-                                                      /*******************PORT E**********************/ 
-         PORT_E,PORTE_PE0,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_E,PORTE_PE1,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_E,PORTE_PE2,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_E,PORTE_PE3,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_E,PORTE_PE4,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_E,PORTE_PE5,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-                                                      /*******************PORT F**********************/ 
-         PORT_F,PORTF_PF0,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_F,PORTF_PF1,PORT_PIN_DEFAULT_MODE,PORT_PIN_OUT               ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,   //LED
-         PORT_F,PORTF_PF2,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_F,PORTF_PF3,PORT_PIN_DEFAULT_MODE,PORT_PIN_DEFAULT_DIRECTION ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-         PORT_F,PORTF_PF4,PORT_PIN_DEFAULT_MODE,PORT_PIN_IN                ,PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,PORT_PIN_DEFAULT_INTERNAL_RESISTOR ,PORT_PIN_DEFAULT_INITIAL_VALUE,PORT_PIN_DEFAULT_MODE_CHANGEABLE,  //BUTTON
-        
-};
\ No newline at end of file
+#define PORT_PBCFG_PIN_MUX_SET_MODE(SET, IN_SET, MODE)   (((SET) == (IN_SET)) ? (MODE) : PORT_PIN_DEFAULT_MODE)
+#define PORT_PBCFG_PIN_MUX_SET_DIRECTION_CHANGEABLE(SET, IN_SET) \
+  (((SET) == (IN_SET)) ? Pin_direction_changeable_ON : PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE)
+#define PORT_PBCFG_PIN_MUX_SET_MODE_CHANGEABLE(SET, IN_SET) \
+  (((SET) == (IN_SET)) ? Pin_mode_changeable_ON : PORT_PIN_DEFAULT_MODE_CHANGEABLE)
+
+#define PORT_PBCFG_PIN_MUX_SET_PINS(ROW, ARG, SET) \
+  /* PORT A */ \
+  ROW(ARG, PORT_A, PORTA_PA0, PORT_PBCFG_PIN_MUX_SET_MODE(SET, PortConf_UART0_PIN_MUX_SET_ID, PORT_ALTERNATE_FUNCTION_UART_MODE), PORT_PIN_DEFAULT_DIRECTION, PORT_PBCFG_PIN_MUX_SET_DIRECTION_CHANGEABLE(SET, PortConf_UART0_PIN_MUX_SET_ID), PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PBCFG_PIN_MUX_SET_MODE_CHANGEABLE(SET, PortConf_UART0_PIN_MUX_SET_ID), PORT_PIN_DEFAULT_INTERRUPT) /* U0RX */ \
+  ROW(ARG, PORT_A, PORTA_PA1, PORT_PBCFG_PIN_MUX_SET_MODE(SET, PortConf_UART0_PIN_MUX_SET_ID, PORT_ALTERNATE_FUNCTION_UART_MODE), PORT_PIN_DEFAULT_DIRECTION, PORT_PBCFG_PIN_MUX_SET_DIRECTION_CHANGEABLE(SET, PortConf_UART0_PIN_MUX_SET_ID), PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PBCFG_PIN_MUX_SET_MODE_CHANGEABLE(SET, PortConf_UART0_PIN_MUX_SET_ID), PORT_PIN_DEFAULT_INTERRUPT) /* U0TX */ \
+  ROW(ARG, PORT_A, PORTA_PA2, PORT_PBCFG_PIN_MUX_SET_MODE(SET, PortConf_SSI0_PIN_MUX_SET_ID, PORT_ALTERNATE_FUNCTION_SSI_MODE), PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) /* SSI0CLK */ \
+  ROW(ARG, PORT_A, PORTA_PA3, PORT_PBCFG_PIN_MUX_SET_MODE(SET, PortConf_SSI0_PIN_MUX_SET_ID, PORT_ALTERNATE_FUNCTION_SSI_MODE), PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) /* SSI0FSS */ \
+  ROW(ARG, PORT_A, PORTA_PA4, PORT_PBCFG_PIN_MUX_SET_MODE(SET, PortConf_SSI0_PIN_MUX_SET_ID, PORT_ALTERNATE_FUNCTION_SSI_MODE), PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) /* SSI0RX */ \
+  ROW(ARG, PORT_A, PORTA_PA5, PORT_PBCFG_PIN_MUX_SET_MODE(SET, PortConf_SSI0_PIN_MUX_SET_ID, PORT_ALTERNATE_FUNCTION_SSI_MODE), PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) /* SSI0TX */ \
+  ROW(ARG, PORT_A, PORTA_PA6, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_A, PORTA_PA7, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  /* PORT B */ \
+  ROW(ARG, PORT_B, PORTB_PB0, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_B, PORTB_PB1, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_B, PORTB_PB2, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_B, PORTB_PB3, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_B, PORTB_PB4, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_B, PORTB_PB5, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_B, PORTB_PB6, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_B, PORTB_PB7, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  /* PORT C */ \
+  ROW(ARG, PORT_C, PORTC_PC0, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_C, PORTC_PC1, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_C, PORTC_PC2, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_C, PORTC_PC3, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_C, PORTC_PC4, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_C, PORTC_PC5, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_C, PORTC_PC6, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_C, PORTC_PC7, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  /* PORT D */ \
+  ROW(ARG, PORT_D, PORTD_PD0, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_D, PORTD_PD1, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_D, PORTD_PD2, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_D, PORTD_PD3, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_D, PORTD_PD4, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_D, PORTD_PD5, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_D, PORTD_PD6, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_D, PORTD_PD7, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  /* PORT E */ \
+  ROW(ARG, PORT_E, PORTE_PE0, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_E, PORTE_PE1, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_E, PORTE_PE2, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_E, PORTE_PE3, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_E, PORTE_PE4, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_E, PORTE_PE5, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  /* PORT F */ \
+  ROW(ARG, PORT_F, PORTF_PF0, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_F, PORTF_PF1, PORT_PIN_DEFAULT_MODE, PORT_PIN_OUT,               PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) /* LED */ \
+  ROW(ARG, PORT_F, PORTF_PF2, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_F, PORTF_PF3, PORT_PIN_DEFAULT_MODE, PORT_PIN_DEFAULT_DIRECTION, PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) \
+  ROW(ARG, PORT_F, PORTF_PF4, PORT_PIN_DEFAULT_MODE, PORT_PIN_IN,                PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE, PORT_PIN_DEFAULT_INTERNAL_RESISTOR, PORT_PIN_DEFAULT_INITIAL_VALUE, PORT_PIN_DEFAULT_MODE_CHANGEABLE, PORT_PIN_DEFAULT_INTERRUPT) /* BUTTON */
+
+/* Pins of each pin-mux set */
+#define PORT_PBCFG_PINS(ROW, ARG)          PORT_PBCFG_PIN_MUX_SET_PINS(ROW, ARG, PortConf_DEFAULT_PIN_MUX_SET_ID)
+#define PORT_PBCFG_UART0_PINS(ROW, ARG)    PORT_PBCFG_PIN_MUX_SET_PINS(ROW, ARG, PortConf_UART0_PIN_MUX_SET_ID)
+#define PORT_PBCFG_SSI0_PINS(ROW, ARG)     PORT_PBCFG_PIN_MUX_SET_PINS(ROW, ARG, PortConf_SSI0_PIN_MUX_SET_ID)
+
+  const Port_ConfigType Port_Configuration = {
+    /* Pins */
+    { PORT_PBCFG_PINS(PORT_CONFIG_PIN, 0) },
+    /* Images */
+    PORT_IMAGES(PORT_PBCFG_PINS)
+  };
+
+#if (PORT_PINMUX_SET_API == STD_ON)
+
+  const Port_ConfigType Port_Uart0Configuration = {
+    { PORT_PBCFG_UART0_PINS(PORT_CONFIG_PIN, 0) },
+    PORT_IMAGES(PORT_PBCFG_UART0_PINS)
+  };
+
+  const Port_ConfigType Port_Ssi0Configuration = {
+    { PORT_PBCFG_SSI0_PINS(PORT_CONFIG_PIN, 0) },
+    PORT_IMAGES(PORT_PBCFG_SSI0_PINS)
+  };
+
+  /* Pin-mux sets in PortConf_*_PIN_MUX_SET_ID order and the differences of the pairs in PORT_PIN_MUX_SET_DIFF_INDEX order */
+  const Port_PinMuxSetsType Port_PinMuxSets = {
+    { &Port_Configuration, &Port_Uart0Configuration, &Port_Ssi0Configuration },
+    {
+      PORT_IMAGE_DIFFS(PORT_PBCFG_PINS, PORT_PBCFG_UART0_PINS),       /* DEFAULT <-> UART0 */
+      PORT_IMAGE_DIFFS(PORT_PBCFG_PINS, PORT_PBCFG_SSI0_PINS),        /* DEFAULT <-> SSI0 */
+      PORT_IMAGE_DIFFS(PORT_PBCFG_UART0_PINS, PORT_PBCFG_SSI0_PINS)   /* UART0 <-> SSI0 */
+    }
+  };
+
+#endif
+
+/*******************************************************************************
+ *                      Build Time Consistency Checks                          *
+ *******************************************************************************/
+/* The images are folded from the same rows as the Pins table, a row that the folding would
+ * get wrong stops the build: negative array size when COND does not hold */
+#define PORT_PBCFG_CHECK(NAME, COND)     typedef char NAME[(COND) ? 1 : -1]
+
+/* Number of rows, of rows in port PORT_NUM and of rows whose pin is not in their port */
+#define PORT_PBCFG_ROW(ARG, P, PIN, MODE, DIR, DCH, RES, INIT, MCH, INT)         + 1UL
+#define PORT_PBCFG_PORT_ROW(ARG, P, PIN, MODE, DIR, DCH, RES, INIT, MCH, INT)    + (((ARG) == (P)) ? 1UL : 0UL)
+#define PORT_PBCFG_BAD_PIN(ARG, P, PIN, MODE, DIR, DCH, RES, INIT, MCH, INT) \
+  + ((((PIN) < PORT_FIRST_PIN_ID(P)) || (PORT_PIN_BIT(P, PIN) > 7UL)) ? 1UL : 0UL)
+
+/* Number of bits set in an 8 bit mask */
+#define PORT_PBCFG_BITS(MASK) \
+  ( ((MASK) & 1UL) + (((MASK) >> 1) & 1UL) + (((MASK) >> 2) & 1UL) + (((MASK) >> 3) & 1UL) + \
+   (((MASK) >> 4) & 1UL) + (((MASK) >> 5) & 1UL) + (((MASK) >> 6) & 1UL) + (((MASK) >> 7) & 1UL) )
+
+/* Pins of port PORT_NUM listed in the image, the JTAG pins included */
+#define PORT_PBCFG_IMAGE_PINS(PORT_NUM) \
+  ((0UL PORT_PBCFG_PINS(PORT_IMAGE_PINS, PORT_NUM)) | (0UL PORT_PBCFG_PINS(PORT_IMAGE_JTAG, PORT_NUM)))
+
+/* Each port has as many image pins as rows, so no pin is listed twice */
+#define PORT_PBCFG_CHECK_PORT(NAME, PORT_NUM) \
+  PORT_PBCFG_CHECK(NAME, PORT_PBCFG_BITS(PORT_PBCFG_IMAGE_PINS(PORT_NUM)) == (0UL PORT_PBCFG_PINS(PORT_PBCFG_PORT_ROW, PORT_NUM)))
+
+PORT_PBCFG_CHECK(Port_PBcfg_RowCountCheck, (0UL PORT_PBCFG_PINS(PORT_PBCFG_ROW, 0)) == PORT_CONFIGURED_PINS);
+PORT_PBCFG_CHECK(Port_PBcfg_PinInPortCheck, (0UL PORT_PBCFG_PINS(PORT_PBCFG_BAD_PIN, 0)) == 0UL);
+PORT_PBCFG_CHECK_PORT(Port_PBcfg_PortACheck, PORT_A);
+PORT_PBCFG_CHECK_PORT(Port_PBcfg_PortBCheck, PORT_B);
+PORT_PBCFG_CHECK_PORT(Port_PBcfg_PortCCheck, PORT_C);
+PORT_PBCFG_CHECK_PORT(Port_PBcfg_PortDCheck, PORT_D);
+PORT_PBCFG_CHECK_PORT(Port_PBcfg_PortECheck, PORT_E);
+PORT_PBCFG_CHECK_PORT(Port_PBcfg_PortFCheck, PORT_F);
+
+#if (PORT_PINMUX_SET_API == STD_ON)
+/* Port_SwitchPinMuxSet writes only the pin-mux and electrical registers, the pin-mux sets shall agree on
+ * the pins (so on the clocked ports and the pin database), on the locked pins and on the edge
+ * interrupts which stay the ones written by Port_Init */
+#define PORT_PBCFG_SAME_FIELD(A, B, FIELD) \
+  ((PORT_DIFF_FIELD(A, B, FIELD, PORT_A) | PORT_DIFF_FIELD(A, B, FIELD, PORT_B) | PORT_DIFF_FIELD(A, B, FIELD, PORT_C) | \
+    PORT_DIFF_FIELD(A, B, FIELD, PORT_D) | PORT_DIFF_FIELD(A, B, FIELD, PORT_E) | PORT_DIFF_FIELD(A, B, FIELD, PORT_F)) == 0UL)
+#define PORT_PBCFG_CHECK_PIN_MUX_SET(NAME, LIST) \
+  PORT_PBCFG_CHECK(NAME, PORT_PBCFG_SAME_FIELD(PORT_PBCFG_PINS, LIST, PORT_IMAGE_PINS) && \
+                         PORT_PBCFG_SAME_FIELD(PORT_PBCFG_PINS, LIST, PORT_IMAGE_JTAG) && \
+                         PORT_PBCFG_SAME_FIELD(PORT_PBCFG_PINS, LIST, PORT_IMAGE_COMMIT) && \
+                         PORT_PBCFG_SAME_FIELD(PORT_PBCFG_PINS, LIST, PORT_IMAGE_INT_PINS) && \
+                         PORT_PBCFG_SAME_FIELD(PORT_PBCFG_PINS, LIST, PORT_IMAGE_INT_BOTH_EDGES) && \
+                         PORT_PBCFG_SAME_FIELD(PORT_PBCFG_PINS, LIST, PORT_IMAGE_INT_EVENT))
+
+PORT_PBCFG_CHECK(Port_PBcfg_PinMuxSetCountCheck, (sizeof(Port_PinMuxSets.Sets) / sizeof(Port_PinMuxSets.Sets[0])) == PORT_NUMBER_OF_PIN_MUX_SETS);
+PORT_PBCFG_CHECK_PIN_MUX_SET(Port_PBcfg_Uart0PinMuxSetCheck, PORT_PBCFG_UART0_PINS);
+PORT_PBCFG_CHECK_PIN_MUX_SET(Port_PBcfg_Ssi0PinMuxSetCheck, PORT_PBCFG_SSI0_PINS);
+#endif
@@ -14,6 +14,9 @@
 
 #include "Std_Types.h"
 
+/* Port Pre-Compile Configuration Header file, selects the GPIO aperture of each port */
+#include "Port_Cfg.h"
+
 /*******************************************************************************
  *                              Module Definitions                             *
  *******************************************************************************/
@@ -22,21 +25,63 @@
  *                              PORT Module Registers                                *
  *******************************************************************************/
 
-/* RCC register which is responsible of enabling GPIO port Clock */
-#define SYSCTL_REGCGC2_REG                (*((volatile uint32*) 0x400FE108)) 
+/* GPIO Run Mode Clock Gating Control register which is responsible of enabling GPIO port Clock */
+#define SYSCTL_RCGCGPIO_ADDRESS           0x400FE608
+
+/* GPIO Peripheral Ready register, a port bit is set once its clock has started */
+#define SYSCTL_PRGPIO_ADDRESS             0x400FEA08
+
+
+/* GPIO High-Performance Bus Control register which selects the AHB/APB aperture of each port */
+#define SYSCTL_GPIOHBCTL_ADDRESS          0x400FE06C
+
+/* GPIO Registers base addresses through the legacy APB aperture */
+#define GPIO_PORTA_APB_BASE_ADDRESS       0x40004000
+#define GPIO_PORTB_APB_BASE_ADDRESS       0x40005000
+#define GPIO_PORTC_APB_BASE_ADDRESS       0x40006000
+#define GPIO_PORTD_APB_BASE_ADDRESS       0x40007000
+#define GPIO_PORTE_APB_BASE_ADDRESS       0x40024000
+#define GPIO_PORTF_APB_BASE_ADDRESS       0x40025000
 
+/* GPIO Registers base addresses through the AHB aperture */
+#define GPIO_PORTA_AHB_BASE_ADDRESS       0x40058000
+#define GPIO_PORTB_AHB_BASE_ADDRESS       0x40059000
+#define GPIO_PORTC_AHB_BASE_ADDRESS       0x4005A000
+#define GPIO_PORTD_AHB_BASE_ADDRESS       0x4005B000
+#define GPIO_PORTE_AHB_BASE_ADDRESS       0x4005C000
+#define GPIO_PORTF_AHB_BASE_ADDRESS       0x4005D000
 
-/* GPIO Registers base addresses */
-#define GPIO_PORTA_BASE_ADDRESS           0x40004000
-#define GPIO_PORTB_BASE_ADDRESS           0x40005000
-#define GPIO_PORTC_BASE_ADDRESS           0x40006000
-#define GPIO_PORTD_BASE_ADDRESS           0x40007000
-#define GPIO_PORTE_BASE_ADDRESS           0x40024000
-#define GPIO_PORTF_BASE_ADDRESS           0x40025000
+/* Selects the AHB or the APB base address of port PORT_NUM according to PORT_GPIO_AHB_PORTS_MASK */
+#define PORT_GPIO_APERTURE(PORT_NUM,APB,AHB) \
+  ((PORT_GPIO_AHB_PORTS_MASK & (1U << (PORT_NUM))) ? (AHB) : (APB))
+
+/* GPIO Registers base addresses through the configured aperture */
+#define GPIO_PORTA_BASE_ADDRESS           PORT_GPIO_APERTURE(PORT_A, GPIO_PORTA_APB_BASE_ADDRESS, GPIO_PORTA_AHB_BASE_ADDRESS)
+#define GPIO_PORTB_BASE_ADDRESS           PORT_GPIO_APERTURE(PORT_B, GPIO_PORTB_APB_BASE_ADDRESS, GPIO_PORTB_AHB_BASE_ADDRESS)
+#define GPIO_PORTC_BASE_ADDRESS           PORT_GPIO_APERTURE(PORT_C, GPIO_PORTC_APB_BASE_ADDRESS, GPIO_PORTC_AHB_BASE_ADDRESS)
+#define GPIO_PORTD_BASE_ADDRESS           PORT_GPIO_APERTURE(PORT_D, GPIO_PORTD_APB_BASE_ADDRESS, GPIO_PORTD_AHB_BASE_ADDRESS)
+#define GPIO_PORTE_BASE_ADDRESS           PORT_GPIO_APERTURE(PORT_E, GPIO_PORTE_APB_BASE_ADDRESS, GPIO_PORTE_AHB_BASE_ADDRESS)
+#define GPIO_PORTF_BASE_ADDRESS           PORT_GPIO_APERTURE(PORT_F, GPIO_PORTF_APB_BASE_ADDRESS, GPIO_PORTF_AHB_BASE_ADDRESS)
+
+/* Mask of the 8 pins of a port in the GPIO per-pin registers, and of their PMCx fields in GPIOPCTL */
+#define PORT_ALL_PINS_MASK                0xFFU
+
+/* Pins implemented in PORTE (PE0 --> PE5) and PORTF (PF0 --> PF4), the other ports have 8 pins */
+#define PORT_E_PINS_MASK                  0x3FU
+#define PORT_F_PINS_MASK                  0x1FU
+#define PORT_CTL_ALL_PINS_MASK            0xFFFFFFFFU
+
+/* Mask of all the GPIO ports bits in GPIOHBCTL */
+#define PORT_GPIO_HBCTL_PORTS_MASK        0x3F
 
 /* GPIO Registers offset addresses */
 #define PORT_DATA_REG_OFFSET              0x3FC
 #define PORT_DIR_REG_OFFSET               0x400
+#define PORT_INT_SENSE_REG_OFFSET         0x404
+#define PORT_INT_BOTH_EDGES_REG_OFFSET    0x408
+#define PORT_INT_EVENT_REG_OFFSET         0x40C
+#define PORT_INT_MASK_REG_OFFSET          0x410
+#define PORT_INT_CLEAR_REG_OFFSET         0x41C
 #define PORT_ALT_FUNC_REG_OFFSET          0x420
 #define PORT_PULL_UP_REG_OFFSET           0x510
 #define PORT_PULL_DOWN_REG_OFFSET         0x514
@@ -46,4 +91,7 @@
 #define PORT_ANALOG_MODE_SEL_REG_OFFSET   0x528
 #define PORT_CTL_REG_OFFSET               0x52C
 
+/* NVIC interrupt number of the GPIO port PORT_NUM, PORTA --> PORTE are 0 --> 4 and PORTF is 30 */
+#define PORT_GPIO_IRQ_NUM(PORT_NUM)       (((PORT_NUM) == PORT_F) ? 30U : (uint32)(PORT_NUM))
+
 #endif /* PORT_REGS_H */
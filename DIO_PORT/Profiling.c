@@ -0,0 +1,88 @@
+ /******************************************************************************
+ *
+ * Module: Profiling
+ *
+ * File Name: Profiling.c
+ *
+ * Description: Cycle count statistics shared by the Dio and Port service profiling.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Profiling.h"
+
+/************************************************************************************
+* Service Name: Profiling_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start the DWT cycle counter.
+************************************************************************************/
+void Profiling_Init(void)
+{
+	PROFILING_START_CYCLE_COUNTER();
+}
+
+/************************************************************************************
+* Service Name: Profiling_Record
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Cycles - Duration of one call of the service.
+* Parameters (inout): Stat - Statistics of the service.
+* Parameters (out): None
+* Return value: None
+* Description: Function to add one measurement to the statistics of a service.
+************************************************************************************/
+void Profiling_Record(Profiling_StatType * Stat, uint32 Cycles)
+{
+	if ((0U == Stat->Count) || (Cycles < Stat->Min))
+	{
+		Stat->Min = Cycles;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	if (Cycles > Stat->Max)
+	{
+		Stat->Max = Cycles;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	Stat->Total += Cycles;
+	Stat->Count++;
+}
+
+/************************************************************************************
+* Service Name: Profiling_GetResult
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Stat - Statistics of the service.
+* Parameters (inout): None
+* Parameters (out): Result - Count, min, max and mean duration of the service.
+* Return value: Std_ReturnType - E_NOT_OK if the service was never measured.
+* Description: Function to convert the statistics of a service.
+************************************************************************************/
+Std_ReturnType Profiling_GetResult(const Profiling_StatType * Stat, Profiling_ResultType * Result)
+{
+	Std_ReturnType ret = E_NOT_OK;
+
+	if (0U != Stat->Count)
+	{
+		Result->Count = Stat->Count;
+		Result->Min   = Stat->Min;
+		Result->Max   = Stat->Max;
+		Result->Mean  = (uint32)(Stat->Total / Stat->Count);
+		ret = E_OK;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return ret;
+}
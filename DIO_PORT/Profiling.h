@@ -0,0 +1,77 @@
+ /******************************************************************************
+ *
+ * Module: Profiling
+ *
+ * File Name: Profiling.h
+ *
+ * Description: Cycle count statistics shared by the Dio and Port service profiling.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef PROFILING_H
+#define PROFILING_H
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/*******************************************************************************
+ *                              Module Definitions                             *
+ *******************************************************************************/
+
+/* DWT registers and the register access layer */
+#include "tm4c123gh6pm_registers.h"
+#include "Mmio.h"
+
+/* Cortex-M4 DWT cycle counter started by Profiling_Init, on the host build (MMIO_SIMULATION)
+ * Mmio_Sim.c returns the estimated bus cycles of the counted register accesses */
+#define PROFILING_GET_CYCLES()         MMIO_READ32(DWT_CYCCNT_ADDRESS)
+
+/* DEMCR trace enable and DWT_CTRL cycle counter enable bits */
+#define PROFILING_DEMCR_TRCENA         (0x01000000U)
+#define PROFILING_DWT_CYCCNTENA        (0x00000001U)
+
+/* Start the DWT cycle counter, used by the profiling, the Dio trace and the capture timestamps */
+#define PROFILING_START_CYCLE_COUNTER() \
+	do \
+	{ \
+		MMIO_SET_BITS32(CORE_DEMCR_ADDRESS, PROFILING_DEMCR_TRCENA); \
+		MMIO_SET_BITS32(DWT_CTRL_ADDRESS, PROFILING_DWT_CYCCNTENA); \
+	} while (0)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Statistics of one service, updated each time the service returns */
+typedef struct
+{
+	uint32 Count;
+	uint32 Min;
+	uint32 Max;
+	uint64 Total;
+}Profiling_StatType;
+
+/* Statistics of one service as returned by the query APIs, in cycles */
+typedef struct
+{
+	uint32 Count;
+	uint32 Min;
+	uint32 Max;
+	uint32 Mean;
+}Profiling_ResultType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function to start the cycle counter, to be called once before Port_Init */
+void Profiling_Init(void);
+
+/* Function to add one measurement to the statistics of a service */
+void Profiling_Record(Profiling_StatType * Stat, uint32 Cycles);
+
+/* Function to convert the statistics of a service, returns E_NOT_OK if it was never measured */
+Std_ReturnType Profiling_GetResult(const Profiling_StatType * Stat, Profiling_ResultType * Result);
+
+#endif /* PROFILING_H */
@@ -0,0 +1,80 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test.h
+ *
+ * Description: Header file of the host tests of the Dio and Port drivers. The tests
+ *              run the drivers against the simulated register file of Mmio_Sim.c,
+ *              see CMakeLists.txt.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef TEST_H
+#define TEST_H
+
+#include "Std_Types.h"
+
+/*******************************************************************************
+ *                              Module Definitions                             *
+ *******************************************************************************/
+
+/* Check COND, a failing check is printed with its location and counted by Test_Check */
+#define TEST_CHECK(COND) \
+	Test_Check((boolean)((COND) ? TRUE : FALSE), #COND, __FILE__, __LINE__)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Development errors reported to the host Det since the last Test_DetReset */
+typedef struct
+{
+	/* Number of reported errors */
+	uint32 Count;
+	/* Arguments of the last reported error */
+	uint16 ModuleId;
+	uint8 InstanceId;
+	uint8 ApiId;
+	uint8 ErrorId;
+}Test_DetErrorsType;
+
+/*******************************************************************************
+ *                              External Variables                             *
+ *******************************************************************************/
+
+/* Errors recorded by Det_ReportError of Test_Det.c */
+extern Test_DetErrorsType Test_DetErrors;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function to count and print a failed check, used through TEST_CHECK */
+void Test_Check(boolean Passed, const char * Expression, const char * File, int Line);
+
+/* Function to clear the errors recorded by the host Det */
+void Test_DetReset(void);
+
+/* Function to reset the simulated register file, initialize Port and Dio with the shipped
+ * configurations and clear the access counters and the recorded Det errors */
+void Test_InitDrivers(void);
+
+/* Test groups, each one is called once by main */
+void Test_Profile(void);
+void Test_Sim(void);
+void Test_Budget(void);
+void Test_Access(void);
+void Test_Bench(void);
+void Test_Pattern(void);
+void Test_Capture(void);
+void Test_Update(void);
+void Test_PinMux(void);
+void Test_PinBatch(void);
+void Test_MultiChannel(void);
+void Test_Debounce(void);
+void Test_ReadCache(void);
+void Test_Trace(void);
+
+#endif /* TEST_H */
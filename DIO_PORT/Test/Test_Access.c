@@ -0,0 +1,117 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_Access.c
+ *
+ * Description: Checks that the channel and port write services leave GPIODATA exactly
+ *              as the read-modify-write of the full register does, whatever the
+ *              DIO_CHANNEL_ACCESS_MODE the test executable is built with.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Mmio.h"
+#include "Port.h"
+#include "Port_Regs.h"
+#include "Dio.h"
+
+/* Full GPIODATA register and direction register of PORTF, where the configured channels are */
+#define TEST_ACCESS_DATA_ADDRESS    (GPIO_PORTF_BASE_ADDRESS + PORT_DATA_REG_OFFSET)
+#define TEST_ACCESS_DIR_ADDRESS     (GPIO_PORTF_BASE_ADDRESS + PORT_DIR_REG_OFFSET)
+
+/* Output latch of the 8 PORTF pins, they are all outputs during the test */
+STATIC uint8 Test_AccessData(void)
+{
+	return (uint8)(Mmio_SimPeek32(TEST_ACCESS_DATA_ADDRESS) & PORT_ALL_PINS_MASK);
+}
+
+/* Put Value in GPIODATA of PORTF */
+STATIC void Test_AccessLoad(uint8 Value)
+{
+	MMIO_WRITE32(TEST_ACCESS_DATA_ADDRESS, Value);
+}
+
+void Test_Access(void)
+{
+	Mmio_SimCountersType Counters;
+	uint32 Initial;
+	uint32 Level;
+	uint32 Mask;
+	uint8 ChannelId;
+	uint8 Expected;
+
+	Test_InitDrivers();
+	/* Make every PORTF pin an output so GPIODATA reads back the value written to it */
+	MMIO_WRITE32(TEST_ACCESS_DIR_ADDRESS, PORT_ALL_PINS_MASK);
+
+	for (Initial = 0U; Initial <= PORT_ALL_PINS_MASK; Initial++)
+	{
+		for (ChannelId = 0U; ChannelId < DIO_CONFIGURED_CHANNLES; ChannelId++)
+		{
+			for (Level = STD_LOW; Level <= STD_HIGH; Level++)
+			{
+				/* Reference: read-modify-write of the full register */
+				Test_AccessLoad((uint8)Initial);
+				if (STD_HIGH == Level)
+				{
+					MMIO_SET_BITS32(TEST_ACCESS_DATA_ADDRESS, 1U << Dio_Configuration.Channels[ChannelId].Ch_Num);
+				}
+				else
+				{
+					MMIO_CLEAR_BITS32(TEST_ACCESS_DATA_ADDRESS, 1U << Dio_Configuration.Channels[ChannelId].Ch_Num);
+				}
+				Expected = Test_AccessData();
+
+				Test_AccessLoad((uint8)Initial);
+				Dio_WriteChannel(ChannelId, (Dio_LevelType)Level);
+				TEST_CHECK(Expected == Test_AccessData());
+#if (DIO_READ_CACHE == STD_OFF)
+				/* With the read cache Dio_ReadChannel returns the last snapshot, see Test_ReadCache.c */
+				TEST_CHECK(Level == Dio_ReadChannel(ChannelId));
+#endif
+			}
+
+			/* Flip: the reference toggles the channel bit of the full register */
+			Test_AccessLoad((uint8)Initial);
+			MMIO_WRITE32(TEST_ACCESS_DATA_ADDRESS,
+			             MMIO_READ32(TEST_ACCESS_DATA_ADDRESS) ^ (1U << Dio_Configuration.Channels[ChannelId].Ch_Num));
+			Expected = Test_AccessData();
+
+			Test_AccessLoad((uint8)Initial);
+			(void)Dio_FlipChannel(ChannelId);
+			TEST_CHECK(Expected == Test_AccessData());
+		}
+	}
+
+	/* Every level under every mask from two different starting values */
+	for (Initial = 0x00U; Initial <= PORT_ALL_PINS_MASK; Initial += 0xA5U)
+	{
+		for (Mask = 0U; Mask <= PORT_ALL_PINS_MASK; Mask++)
+		{
+			for (Level = 0U; Level <= PORT_ALL_PINS_MASK; Level++)
+			{
+				Test_AccessLoad((uint8)Initial);
+				MMIO_WRITE32(TEST_ACCESS_DATA_ADDRESS, (MMIO_READ32(TEST_ACCESS_DATA_ADDRESS) & ~Mask) | (Level & Mask));
+				Expected = Test_AccessData();
+
+				Test_AccessLoad((uint8)Initial);
+				Dio_MaskedWritePort(DioConf_PORTF_PORT_ID_INDEX, (Dio_PortLevelType)Level, (Dio_PortLevelType)Mask);
+				if (Expected != Test_AccessData())
+				{
+					/* Checked on mismatch only, 131072 passing checks would drown the summary */
+					TEST_CHECK(Expected == Test_AccessData());
+				}
+				else
+				{
+					/* No Action Required */
+				}
+			}
+		}
+	}
+
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK(0U == Counters.Faults);
+	TEST_CHECK(0U == Test_DetErrors.Count);
+}
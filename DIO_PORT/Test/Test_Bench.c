@@ -0,0 +1,104 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_Bench.c
+ *
+ * Description: Measures the register accesses of the Dio write services with the
+ *              counters of the simulated register file and prints them.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include <stdio.h>
+
+#include "Test.h"
+#include "Mmio.h"
+#include "Port.h"
+#include "Dio.h"
+
+/* Number of pins updated by the port update benchmark */
+#define TEST_BENCH_PINS     (8U)
+
+/* Run CALL from cleared counters and copy its counters to COUNTERS */
+#define TEST_BENCH(COUNTERS, CALL) \
+	do \
+	{ \
+		Mmio_SimResetCounters(); \
+		CALL; \
+		Mmio_SimGetCounters(COUNTERS); \
+	} while (0)
+
+/* Name of the channel access mode the executable is built with */
+#if (DIO_CHANNEL_ACCESS_MODE == DIO_CHANNEL_ACCESS_BITBAND)
+#define TEST_BENCH_ACCESS_MODE_NAME "bit-band"
+#elif (DIO_CHANNEL_ACCESS_MODE == DIO_CHANNEL_ACCESS_MASKED)
+#define TEST_BENCH_ACCESS_MODE_NAME "masked"
+#else
+#define TEST_BENCH_ACCESS_MODE_NAME "read-modify-write"
+#endif
+
+/* Name of the aperture PORTF, where the configured channels are, is accessed through */
+#if (PORT_GPIO_AHB_PORTS_MASK & (1U << PORT_F))
+#define TEST_BENCH_APERTURE_NAME "AHB"
+#else
+#define TEST_BENCH_APERTURE_NAME "APB"
+#endif
+
+/* Print the counters of one benchmark */
+STATIC void Test_BenchPrint(const char * Name, const Mmio_SimCountersType * Counters)
+{
+	printf("  %-28s %3lu reads %3lu writes %3lu bus cycles\n", Name,
+	       (unsigned long)Counters->Reads, (unsigned long)Counters->Writes, (unsigned long)Counters->BusCycles);
+}
+
+void Test_Bench(void)
+{
+	Dio_ChannelType Channels[TEST_BENCH_PINS];
+	Dio_LevelType Levels[TEST_BENCH_PINS];
+	Mmio_SimCountersType ChannelWrites;
+	Mmio_SimCountersType PortWrite;
+	Mmio_SimCountersType ChannelsWrite;
+	Mmio_SimCountersType Counters;
+	uint8 Index;
+
+	Test_InitDrivers();
+
+	/* Channel services with the access mode of this executable */
+	printf("Channel services, %s access, %s aperture:\n", TEST_BENCH_ACCESS_MODE_NAME, TEST_BENCH_APERTURE_NAME);
+	TEST_BENCH(&Counters, Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH));
+	Test_BenchPrint("Dio_WriteChannel", &Counters);
+	TEST_CHECK(0U == Counters.Faults);
+	TEST_BENCH(&Counters, (void)Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX));
+	Test_BenchPrint("Dio_ReadChannel", &Counters);
+	TEST_CHECK(0U == Counters.Faults);
+	TEST_BENCH(&Counters, (void)Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX));
+	Test_BenchPrint("Dio_FlipChannel", &Counters);
+	TEST_CHECK(0U == Counters.Faults);
+
+	/*
+	 * Update 8 pins: the configuration has 2 channels, so the 8 channel writes cycle through
+	 * them, which costs the same as 8 distinct channels of one port.
+	 */
+	for (Index = 0U; Index < TEST_BENCH_PINS; Index++)
+	{
+		Channels[Index] = (Dio_ChannelType)(Index % DIO_CONFIGURED_CHANNLES);
+		Levels[Index]   = (Dio_LevelType)(Index & 1U);
+	}
+	TEST_BENCH(&ChannelWrites,
+	           for (Index = 0U; Index < TEST_BENCH_PINS; Index++) { Dio_WriteChannel(Channels[Index], Levels[Index]); });
+	TEST_BENCH(&PortWrite, Dio_WritePort(DioConf_PORTF_PORT_ID_INDEX, 0x55U));
+	TEST_BENCH(&ChannelsWrite, Dio_WriteChannels(Channels, Levels, TEST_BENCH_PINS));
+
+	printf("Port update of %u pins, %s aperture:\n", TEST_BENCH_PINS, TEST_BENCH_APERTURE_NAME);
+	Test_BenchPrint("8 x Dio_WriteChannel", &ChannelWrites);
+	Test_BenchPrint("Dio_WritePort", &PortWrite);
+	Test_BenchPrint("Dio_WriteChannels (8)", &ChannelsWrite);
+
+	/* The port services update the whole port with one store */
+	TEST_CHECK((0U == PortWrite.Reads) && (1U == PortWrite.Writes));
+	TEST_CHECK((0U == ChannelsWrite.Reads) && (1U == ChannelsWrite.Writes));
+	TEST_CHECK(PortWrite.BusCycles < ChannelWrites.BusCycles);
+	TEST_CHECK(ChannelsWrite.BusCycles < ChannelWrites.BusCycles);
+	TEST_CHECK(0U == Test_DetErrors.Count);
+}
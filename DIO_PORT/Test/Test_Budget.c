@@ -0,0 +1,114 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_Budget.c
+ *
+ * Description: Runs the call sequence of Mmio_Budget.h and checks the register
+ *              accesses of each call against its budget.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include <stdio.h>
+
+#include "Test.h"
+#include "Mmio.h"
+#include "Mmio_Budget.h"
+#include "Port.h"
+#include "Port_Regs.h"
+#include "Dio.h"
+#include "Dio_Pattern.h"
+#include "Dio_Capture.h"
+
+/* Run CALL from cleared counters and check its accesses against BUDGET */
+#define TEST_BUDGET(BUDGET, CALL) \
+	do \
+	{ \
+		static const Mmio_SimBudgetType Test_Budget = BUDGET; \
+		Mmio_SimResetCounters(); \
+		CALL; \
+		Test_CheckBudget(&Test_Budget, #CALL, __FILE__, __LINE__); \
+	} while (0)
+
+/* Check the counters against Budget, print the counters of a call over its budget */
+STATIC void Test_CheckBudget(const Mmio_SimBudgetType * Budget, const char * Call, const char * File, int Line)
+{
+	Mmio_SimCountersType Counters;
+
+	Mmio_SimGetCounters(&Counters);
+	if (E_NOT_OK == Mmio_SimCheckBudget(Budget))
+	{
+		printf("%s:%d: %s: %lu reads, %lu writes, %lu bus cycles, %lu faults, budget {%lu, %lu, %lu}\n",
+		       File, Line, Call,
+		       (unsigned long)Counters.Reads, (unsigned long)Counters.Writes,
+		       (unsigned long)Counters.BusCycles, (unsigned long)Counters.Faults,
+		       (unsigned long)Budget->Reads, (unsigned long)Budget->Writes, (unsigned long)Budget->BusCycles);
+		Test_Check(FALSE, "over budget", File, Line);
+	}
+	else
+	{
+		Test_Check(TRUE, "within budget", File, Line);
+	}
+}
+
+void Test_Budget(void)
+{
+	static const Port_PinType DirectionPins[2] = {PORTA_PA0, PORTA_PA1};
+	static const Port_PinDirectionType Directions[2] = {PORT_PIN_IN, PORT_PIN_OUT};
+	static const Port_PinModeType Modes[2] = {PORT_ALTERNATE_FUNCTION_UART_MODE, PORT_ALTERNATE_FUNCTION_UART_MODE};
+	static const Dio_ChannelType Channels[2] = {DioConf_LED1_CHANNEL_ID_INDEX, DioConf_SW1_CHANNEL_ID_INDEX};
+	static const Dio_LevelType Levels[2] = {STD_HIGH, STD_LOW};
+	static const Dio_PortLevelType Pattern[4] = {0x02U, 0x04U, 0x08U, 0x00U};
+	Dio_PortsSnapshotType Snapshot;
+	uint32 Rising;
+	uint32 Falling;
+
+	Mmio_SimReset();
+	Test_DetReset();
+
+	/* Port services */
+	TEST_BUDGET(MMIO_BUDGET_PORT_INIT, Port_Init(&Port_Configuration));
+	TEST_BUDGET(MMIO_BUDGET_PORT_REFRESH_PORT_DIRECTION, Port_RefreshPortDirection());
+	TEST_BUDGET(MMIO_BUDGET_PORT_SET_PIN_DIRECTION, Port_SetPinDirection(PORTF_PF1, PORT_PIN_OUT));
+	TEST_CHECK((1U == Test_DetErrors.Count) && (PORT_E_DIRECTION_UNCHANGEABLE == Test_DetErrors.ErrorId));
+	Test_DetReset();
+	TEST_BUDGET(MMIO_BUDGET_PORT_SWITCH_PIN_MUX_SET, Port_SwitchPinMuxSet(PortConf_UART0_PIN_MUX_SET_ID));
+	/* PA0/PA1 are direction and mode changeable in the UART0 pin-mux set only */
+	TEST_BUDGET(MMIO_BUDGET_PORT_SET_PIN_MODE, Port_SetPinMode(PORTA_PA0, PORT_DIO_MODE));
+	TEST_BUDGET(MMIO_BUDGET_PORT_SET_PIN_DIRECTIONS, Port_SetPinDirections(DirectionPins, Directions, 2U));
+	TEST_BUDGET(MMIO_BUDGET_PORT_SET_PIN_MODES, Port_SetPinModes(DirectionPins, Modes, 2U));
+
+	/* Dio services */
+	TEST_BUDGET(MMIO_BUDGET_DIO_INIT, Dio_Init(&Dio_Configuration));
+	TEST_BUDGET(MMIO_BUDGET_DIO_WRITE_CHANNEL, Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH));
+	TEST_BUDGET(MMIO_BUDGET_DIO_READ_CHANNEL, (void)Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX));
+	TEST_BUDGET(MMIO_BUDGET_DIO_FLIP_CHANNEL, (void)Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX));
+	TEST_BUDGET(MMIO_BUDGET_DIO_READ_PORT, (void)Dio_ReadPort(DioConf_PORTF_PORT_ID_INDEX));
+	TEST_BUDGET(MMIO_BUDGET_DIO_WRITE_PORT, Dio_WritePort(DioConf_PORTF_PORT_ID_INDEX, 0x0FU));
+	TEST_BUDGET(MMIO_BUDGET_DIO_MASKED_WRITE_PORT, Dio_MaskedWritePort(DioConf_PORTF_PORT_ID_INDEX, 0x0FU, 0x0EU));
+	TEST_BUDGET(MMIO_BUDGET_DIO_READ_CHANNEL_GROUP, (void)Dio_ReadChannelGroup(DioConf_RGB_LED_GROUP_PTR));
+	TEST_BUDGET(MMIO_BUDGET_DIO_WRITE_CHANNEL_GROUP, Dio_WriteChannelGroup(DioConf_RGB_LED_GROUP_PTR, 5U));
+	TEST_BUDGET(MMIO_BUDGET_DIO_WRITE_CHANNELS, Dio_WriteChannels(Channels, Levels, 2U));
+	TEST_BUDGET(MMIO_BUDGET_DIO_READ_CHANNELS, (void)Dio_ReadChannels(Channels, 2U));
+	TEST_BUDGET(MMIO_BUDGET_DIO_BEGIN_UPDATE, Dio_BeginUpdate());
+	TEST_BUDGET(MMIO_BUDGET_DIO_STAGE_CHANNEL, Dio_StageChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_LOW));
+	TEST_BUDGET(MMIO_BUDGET_DIO_COMMIT, Dio_Commit());
+	TEST_BUDGET(MMIO_BUDGET_DIO_DEBOUNCE_MAIN_FUNCTION, Dio_DebounceMainFunction());
+	TEST_BUDGET(MMIO_BUDGET_DIO_READ_DEBOUNCED_CHANNEL, (void)Dio_ReadDebouncedChannel(DioConf_SW1_CHANNEL_ID_INDEX));
+	TEST_BUDGET(MMIO_BUDGET_DIO_GET_DEBOUNCED_EDGES, Dio_GetDebouncedEdges(&Rising, &Falling));
+	TEST_BUDGET(MMIO_BUDGET_DIO_READ_ALL_PORTS, Dio_ReadAllPorts(&Snapshot));
+	TEST_BUDGET(MMIO_BUDGET_DIO_PATTERN_START, Dio_PatternStart(DioConf_PORTF_PORT_ID_INDEX, 0x0EU, 1000U));
+	(void)Dio_PatternQueue(Pattern, 4U);
+	TEST_BUDGET(MMIO_BUDGET_DIO_PATTERN_TICK, Dio_PatternTick());
+	TEST_BUDGET(MMIO_BUDGET_DIO_PATTERN_STOP, Dio_PatternStop());
+	TEST_BUDGET(MMIO_BUDGET_DIO_CAPTURE_INIT, Dio_CaptureInit());
+
+	/* Unmask the PF4 (SW1) edge interrupt and raise it */
+	MMIO_WRITE32(GPIO_PORTF_BASE_ADDRESS + PORT_INT_MASK_REG_OFFSET, 0x10U);
+	Mmio_SimSetPins(PORT_F, 0x10U);
+	TEST_BUDGET(MMIO_BUDGET_DIO_CAPTURE_ISR, Dio_CaptureIsr(PORT_F));
+
+	/* None of the other calls reports an error */
+	TEST_CHECK(0U == Test_DetErrors.Count);
+}
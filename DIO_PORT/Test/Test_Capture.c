@@ -0,0 +1,109 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_Capture.c
+ *
+ * Description: Injects edges on the simulated PORTF pins, runs the GPIO ISR and checks
+ *              the content and order of the capture ring and its overflow counter.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Mmio.h"
+#include "Port.h"
+#include "Port_Regs.h"
+#include "Dio.h"
+#include "Dio_Capture.h"
+
+/* GPIORIS offset, the latched edges before masking */
+#define TEST_CAPTURE_RIS_REG_OFFSET    (0x414U)
+
+/* PF2, PF3 and PF4 inputs capture both edges */
+#define TEST_CAPTURE_PINS              (0x1CU)
+
+/* Number of events the ring holds, one slot is kept free */
+#define TEST_CAPTURE_CAPACITY          (DIO_CAPTURE_RING_SIZE - 1U)
+
+/* GPIO PORTF ISR of Dio_Capture.c */
+extern void GPIOPortF_Handler(void);
+
+/* Drive the PORTF inputs to Levels and run the PORTF ISR */
+STATIC void Test_CaptureEdge(uint8 Levels)
+{
+	Mmio_SimSetPins(PORT_F, Levels);
+	GPIOPortF_Handler();
+}
+
+void Test_Capture(void)
+{
+	Dio_CaptureEventType Event;
+	Mmio_SimCountersType Counters;
+	uint32 Timestamp;
+	uint8 Index;
+
+	Test_InitDrivers();
+	Mmio_SimSetPins(PORT_F, 0x00U);
+	MMIO_WRITE32(GPIO_PORTF_BASE_ADDRESS + PORT_INT_BOTH_EDGES_REG_OFFSET, TEST_CAPTURE_PINS);
+	MMIO_WRITE32(GPIO_PORTF_BASE_ADDRESS + PORT_INT_MASK_REG_OFFSET, TEST_CAPTURE_PINS);
+	Dio_CaptureInit();
+
+	/* An empty ring reads nothing, a NULL event is reported */
+	TEST_CHECK(E_NOT_OK == Dio_CaptureRead(&Event));
+	TEST_CHECK(E_NOT_OK == Dio_CaptureRead(NULL_PTR));
+	TEST_CHECK(DIO_E_PARAM_POINTER == Test_DetErrors.ErrorId);
+	Test_DetReset();
+
+	/* Rising then falling edge of PF4, then PF2 and PF3 rising together share one event */
+	Test_CaptureEdge(0x10U);
+	TEST_CHECK(0U == (Mmio_SimPeek32(GPIO_PORTF_BASE_ADDRESS + TEST_CAPTURE_RIS_REG_OFFSET) & TEST_CAPTURE_PINS));
+	Test_CaptureEdge(0x00U);
+	Test_CaptureEdge(0x0CU);
+
+	TEST_CHECK(E_OK == Dio_CaptureRead(&Event));
+	TEST_CHECK((PORT_F == Event.Port_Num) && (0x10U == Event.Pins) && (0x10U == Event.Levels));
+	Timestamp = Event.Timestamp;
+	TEST_CHECK(E_OK == Dio_CaptureRead(&Event));
+	TEST_CHECK((PORT_F == Event.Port_Num) && (0x10U == Event.Pins) && (0x00U == Event.Levels));
+	TEST_CHECK(Event.Timestamp > Timestamp);
+	Timestamp = Event.Timestamp;
+	TEST_CHECK(E_OK == Dio_CaptureRead(&Event));
+	TEST_CHECK((PORT_F == Event.Port_Num) && (0x0CU == Event.Pins) && (0x0CU == Event.Levels));
+	TEST_CHECK(Event.Timestamp > Timestamp);
+	TEST_CHECK(E_NOT_OK == Dio_CaptureRead(&Event));
+	TEST_CHECK(0U == Dio_CaptureGetOverflows());
+
+	/* Release PF2 and PF3 then toggle PF4, 5 events more than the ring holds:
+	 * the oldest events are kept and the newest dropped */
+	Test_CaptureEdge(0x00U);
+	for (Index = 0U; Index < (TEST_CAPTURE_CAPACITY + 4U); Index++)
+	{
+		Test_CaptureEdge((0U == (Index & 1U)) ? 0x10U : 0x00U);
+	}
+	TEST_CHECK(5U == Dio_CaptureGetOverflows());
+	TEST_CHECK(0U == (Mmio_SimPeek32(GPIO_PORTF_BASE_ADDRESS + TEST_CAPTURE_RIS_REG_OFFSET) & TEST_CAPTURE_PINS));
+
+	/* The first event is the release of PF2 and PF3 */
+	TEST_CHECK(E_OK == Dio_CaptureRead(&Event));
+	TEST_CHECK((0x0CU == Event.Pins) && (0x00U == Event.Levels));
+	Timestamp = Event.Timestamp;
+	for (Index = 0U; Index < (TEST_CAPTURE_CAPACITY - 1U); Index++)
+	{
+		TEST_CHECK(E_OK == Dio_CaptureRead(&Event));
+		TEST_CHECK((0x10U == Event.Pins) && (((0U == (Index & 1U)) ? 0x10U : 0x00U) == Event.Levels));
+		TEST_CHECK(Event.Timestamp > Timestamp);
+		Timestamp = Event.Timestamp;
+	}
+	TEST_CHECK(E_NOT_OK == Dio_CaptureRead(&Event));
+
+	/* Reading freed the ring, capture goes on with the release of PF4 */
+	Test_CaptureEdge(0x00U);
+	TEST_CHECK(E_OK == Dio_CaptureRead(&Event));
+	TEST_CHECK((0x10U == Event.Pins) && (0x00U == Event.Levels));
+	TEST_CHECK(5U == Dio_CaptureGetOverflows());
+
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK(0U == Counters.Faults);
+	TEST_CHECK(0U == Test_DetErrors.Count);
+}
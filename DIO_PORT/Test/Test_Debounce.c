@@ -0,0 +1,96 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_Debounce.c
+ *
+ * Description: Drives SW1 (PF4) of the simulated PORTF and checks the debounced level
+ *              and the edges latched by the vertical counters of Dio_DebounceMainFunction.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Mmio.h"
+#include "Port.h"
+#include "Dio.h"
+
+/* PF4 (SW1) bit in the PORTF pads and SW1 bit in the edge bitmaps */
+#define TEST_DEBOUNCE_SW1_PIN     (0x10U)
+#define TEST_DEBOUNCE_SW1_EDGE    ((uint32)1U << DioConf_SW1_CHANNEL_ID_INDEX)
+
+/* Drive SW1 to Level and take Samples debounce samples */
+STATIC void Test_DebounceSample(uint8 Level, uint8 Samples)
+{
+	uint8 Index;
+
+	Mmio_SimSetPins(PORT_F, (STD_HIGH == Level) ? TEST_DEBOUNCE_SW1_PIN : 0x00U);
+	for (Index = 0U; Index < Samples; Index++)
+	{
+		Dio_DebounceMainFunction();
+	}
+}
+
+void Test_Debounce(void)
+{
+	Mmio_SimCountersType Counters;
+	uint32 Rising;
+	uint32 Falling;
+
+	Test_InitDrivers();
+
+	/* The first sample is the debounced level, it is not an edge */
+	Test_DebounceSample(STD_HIGH, 1U);
+	TEST_CHECK(STD_HIGH == Dio_ReadDebouncedChannel(DioConf_SW1_CHANNEL_ID_INDEX));
+	Dio_GetDebouncedEdges(&Rising, &Falling);
+	TEST_CHECK((0U == Rising) && (0U == Falling));
+
+	/* A new level is taken on the DIO_DEBOUNCE_SAMPLES-th equal sample only */
+	Test_DebounceSample(STD_LOW, DIO_DEBOUNCE_SAMPLES - 1U);
+	TEST_CHECK(STD_HIGH == Dio_ReadDebouncedChannel(DioConf_SW1_CHANNEL_ID_INDEX));
+	Test_DebounceSample(STD_LOW, 1U);
+	TEST_CHECK(STD_LOW == Dio_ReadDebouncedChannel(DioConf_SW1_CHANNEL_ID_INDEX));
+
+	/* The falling edge is latched until Dio_GetDebouncedEdges returns it */
+	Test_DebounceSample(STD_LOW, 2U);
+	Dio_GetDebouncedEdges(&Rising, &Falling);
+	TEST_CHECK((0U == Rising) && (TEST_DEBOUNCE_SW1_EDGE == Falling));
+	Dio_GetDebouncedEdges(&Rising, &Falling);
+	TEST_CHECK((0U == Rising) && (0U == Falling));
+
+	/* A bounce back to the debounced level inside the window restarts the count */
+	Test_DebounceSample(STD_HIGH, DIO_DEBOUNCE_SAMPLES - 1U);
+	Test_DebounceSample(STD_LOW, 1U);
+	Test_DebounceSample(STD_HIGH, DIO_DEBOUNCE_SAMPLES - 1U);
+	TEST_CHECK(STD_LOW == Dio_ReadDebouncedChannel(DioConf_SW1_CHANNEL_ID_INDEX));
+	Dio_GetDebouncedEdges(&Rising, &Falling);
+	TEST_CHECK((0U == Rising) && (0U == Falling));
+	Test_DebounceSample(STD_HIGH, 1U);
+	TEST_CHECK(STD_HIGH == Dio_ReadDebouncedChannel(DioConf_SW1_CHANNEL_ID_INDEX));
+
+	/* The rising edge is latched and cleared the same way */
+	Dio_GetDebouncedEdges(&Rising, &Falling);
+	TEST_CHECK((TEST_DEBOUNCE_SW1_EDGE == Rising) && (0U == Falling));
+	Dio_GetDebouncedEdges(&Rising, &Falling);
+	TEST_CHECK((0U == Rising) && (0U == Falling));
+
+	/* The debounced level is read from RAM, one sample is one GPIODATA read */
+	Mmio_SimResetCounters();
+	(void)Dio_ReadDebouncedChannel(DioConf_SW1_CHANNEL_ID_INDEX);
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK((0U == Counters.Reads) && (0U == Counters.Writes));
+	Dio_DebounceMainFunction();
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK((1U == Counters.Reads) && (0U == Counters.Writes));
+
+	/* Dio_Init seeds the debounced level again from the next sample */
+	Dio_Init(&Dio_Configuration);
+	Test_DebounceSample(STD_LOW, 1U);
+	TEST_CHECK(STD_LOW == Dio_ReadDebouncedChannel(DioConf_SW1_CHANNEL_ID_INDEX));
+	Dio_GetDebouncedEdges(&Rising, &Falling);
+	TEST_CHECK((0U == Rising) && (0U == Falling));
+
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK(0U == Counters.Faults);
+	TEST_CHECK(0U == Test_DetErrors.Count);
+}
@@ -0,0 +1,38 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_Det.c
+ *
+ * Description: Det of the host tests. It records the reported development errors and
+ *              returns, where Det.c of the target build stops in an endless loop.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Det.h"
+#include "Test.h"
+
+Test_DetErrorsType Test_DetErrors;
+
+Std_ReturnType Det_ReportError( uint16 ModuleId,
+                      uint8 InstanceId,
+                      uint8 ApiId,
+                      uint8 ErrorId )
+{
+	Test_DetErrors.Count++;
+	Test_DetErrors.ModuleId   = ModuleId;
+	Test_DetErrors.InstanceId = InstanceId;
+	Test_DetErrors.ApiId      = ApiId;
+	Test_DetErrors.ErrorId    = ErrorId;
+	return E_OK;
+}
+
+void Test_DetReset(void)
+{
+	Test_DetErrors.Count      = 0U;
+	Test_DetErrors.ModuleId   = 0U;
+	Test_DetErrors.InstanceId = 0U;
+	Test_DetErrors.ApiId      = 0U;
+	Test_DetErrors.ErrorId    = 0U;
+}
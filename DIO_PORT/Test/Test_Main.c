@@ -0,0 +1,69 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_Main.c
+ *
+ * Description: Entry point of the host tests, it returns nonzero if any check failed.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include <stdio.h>
+
+#include "Test.h"
+#include "Mmio.h"
+#include "Port.h"
+#include "Dio.h"
+
+/* Number of checks done and failed */
+STATIC uint32 Test_Checks = 0U;
+STATIC uint32 Test_Failures = 0U;
+
+void Test_Check(boolean Passed, const char * Expression, const char * File, int Line)
+{
+	Test_Checks++;
+	if (FALSE == Passed)
+	{
+		Test_Failures++;
+		printf("%s:%d: check failed: %s\n", File, Line, Expression);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+void Test_InitDrivers(void)
+{
+	Mmio_SimReset();
+	Port_Init(&Port_Configuration);
+	Dio_Init(&Dio_Configuration);
+	Mmio_SimResetCounters();
+	Test_DetReset();
+}
+
+int main(void)
+{
+	/* First, the profiling statistics are never cleared */
+	Test_Profile();
+	Test_Sim();
+	Test_Access();
+	Test_Bench();
+	Test_Pattern();
+	Test_Capture();
+	Test_Update();
+	Test_MultiChannel();
+	Test_PinMux();
+	Test_PinBatch();
+	Test_Debounce();
+	Test_ReadCache();
+	Test_Trace();
+#ifndef TEST_ACCESS_MODE_VARIANT
+	/* The budgets are recorded with the channel access mode of Dio_Cfg.h and the AHB ports of Port_Cfg.h */
+	Test_Budget();
+#endif
+
+	printf("%lu checks, %lu failed\n", (unsigned long)Test_Checks, (unsigned long)Test_Failures);
+	return (0U == Test_Failures) ? 0 : 1;
+}
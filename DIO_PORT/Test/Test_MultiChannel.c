@@ -0,0 +1,81 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_MultiChannel.c
+ *
+ * Description: Checks the PORTF value written by Dio_WriteChannels and the levels
+ *              bitmap of Dio_ReadChannels, both with repeated channels.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Mmio.h"
+#include "Port.h"
+#include "Port_Regs.h"
+#include "Dio.h"
+
+/* Full GPIODATA register and direction register of PORTF, where the configured channels are */
+#define TEST_MULTI_CHANNEL_DATA_ADDRESS    (GPIO_PORTF_BASE_ADDRESS + PORT_DATA_REG_OFFSET)
+#define TEST_MULTI_CHANNEL_DIR_ADDRESS     (GPIO_PORTF_BASE_ADDRESS + PORT_DIR_REG_OFFSET)
+
+/* PF1 (LED1) and PF4 (SW1) bits in the PORTF pads */
+#define TEST_MULTI_CHANNEL_LED1_PIN        (0x02U)
+#define TEST_MULTI_CHANNEL_SW1_PIN         (0x10U)
+
+void Test_MultiChannel(void)
+{
+	static const Dio_ChannelType WriteIds[4] = {DioConf_LED1_CHANNEL_ID_INDEX, DioConf_SW1_CHANNEL_ID_INDEX,
+	                                            DioConf_LED1_CHANNEL_ID_INDEX, DioConf_LED1_CHANNEL_ID_INDEX};
+	static const Dio_LevelType HighLast[4] = {STD_LOW, STD_HIGH, STD_HIGH, 2U};
+	static const Dio_LevelType LowLast[4] = {STD_HIGH, STD_LOW, STD_LOW, 2U};
+	static const Dio_ChannelType ReadIds[5] = {DioConf_SW1_CHANNEL_ID_INDEX, DioConf_LED1_CHANNEL_ID_INDEX,
+	                                           DioConf_SW1_CHANNEL_ID_INDEX, DioConf_SW1_CHANNEL_ID_INDEX,
+	                                           DioConf_LED1_CHANNEL_ID_INDEX};
+	Dio_ChannelType ManyIds[DIO_MAX_READ_CHANNELS + 1U];
+	Mmio_SimCountersType Counters;
+	uint8 Index;
+
+	/* One store writes LED1 and SW1 and leaves the other PORTF bits alone. The last valid level of
+	 * LED1 wins, the invalid one after it is ignored. The PORTF pins are all outputs so GPIODATA
+	 * reads back the output latch */
+	Test_InitDrivers();
+	MMIO_WRITE32(TEST_MULTI_CHANNEL_DIR_ADDRESS, PORT_ALL_PINS_MASK);
+	MMIO_WRITE32(TEST_MULTI_CHANNEL_DATA_ADDRESS, 0x0CU);
+	Mmio_SimResetCounters();
+	Dio_WriteChannels(WriteIds, HighLast, 4U);
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK((0U == Counters.Reads) && (1U == Counters.Writes));
+	TEST_CHECK((0x0CU | TEST_MULTI_CHANNEL_LED1_PIN | TEST_MULTI_CHANNEL_SW1_PIN) ==
+	           (Mmio_SimPeek32(TEST_MULTI_CHANNEL_DATA_ADDRESS) & PORT_ALL_PINS_MASK));
+	TEST_CHECK(TEST_MULTI_CHANNEL_LED1_PIN == (Mmio_SimGetPins(PORT_F) & TEST_MULTI_CHANNEL_LED1_PIN));
+	Dio_WriteChannels(WriteIds, LowLast, 4U);
+	TEST_CHECK(0x0CU == (Mmio_SimPeek32(TEST_MULTI_CHANNEL_DATA_ADDRESS) & PORT_ALL_PINS_MASK));
+	TEST_CHECK(0U == (Mmio_SimGetPins(PORT_F) & TEST_MULTI_CHANNEL_LED1_PIN));
+
+	/* Bit i of the bitmap is the level of ReadIds[i], PORTF is read once */
+	Test_InitDrivers();
+	Mmio_SimSetPins(PORT_F, TEST_MULTI_CHANNEL_SW1_PIN);
+	Mmio_SimResetCounters();
+	TEST_CHECK(0x0DU == Dio_ReadChannels(ReadIds, 5U));
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK((1U == Counters.Reads) && (0U == Counters.Writes));
+	Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH);
+	Mmio_SimSetPins(PORT_F, 0x00U);
+	TEST_CHECK(0x12U == Dio_ReadChannels(ReadIds, 5U));
+
+	/* The bitmap holds up to DIO_MAX_READ_CHANNELS levels, more channels are reported */
+	for (Index = 0U; Index <= DIO_MAX_READ_CHANNELS; Index++)
+	{
+		ManyIds[Index] = (0U == (Index & 1U)) ? DioConf_LED1_CHANNEL_ID_INDEX : DioConf_SW1_CHANNEL_ID_INDEX;
+	}
+	TEST_CHECK(0x55555555U == Dio_ReadChannels(ManyIds, DIO_MAX_READ_CHANNELS));
+	TEST_CHECK(0U == Test_DetErrors.Count);
+	Mmio_SimResetCounters();
+	TEST_CHECK(0U == Dio_ReadChannels(ManyIds, DIO_MAX_READ_CHANNELS + 1U));
+	TEST_CHECK((1U == Test_DetErrors.Count) && (DIO_E_PARAM_LENGTH == Test_DetErrors.ErrorId));
+	Test_DetReset();
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK((0U == Counters.Reads) && (0U == Counters.Writes));
+}
@@ -0,0 +1,137 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_Pattern.c
+ *
+ * Description: Plays patterns with a virtual clock which runs SysTick_Handler every
+ *              tick period programmed in SysTick, and checks the GPIODATA sequence,
+ *              the double buffer swap and the parameter checks of the player.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Mmio.h"
+#include "Port.h"
+#include "Port_Regs.h"
+#include "Dio.h"
+#include "Dio_Pattern.h"
+#include "tm4c123gh6pm_registers.h"
+
+/* Pins driven by the player (RGB LED, PF1 --> PF3) and the tick period used by the test */
+#define TEST_PATTERN_MASK           (0x0EU)
+#define TEST_PATTERN_TICK_PERIOD    (1000U)
+
+/* Longest sequence recorded by the virtual clock */
+#define TEST_PATTERN_MAX_TICKS      (16U)
+
+/* SysTick ISR of Dio_Pattern.c */
+extern void SysTick_Handler(void);
+
+/* Cycles elapsed since the last tick, and GPIODATA of PORTF after each tick */
+STATIC uint32 Test_PatternCycles = 0U;
+STATIC uint8 Test_PatternOutput[TEST_PATTERN_MAX_TICKS];
+STATIC uint8 Test_PatternTicks = 0U;
+
+/* Advance the virtual clock by Cycles, running the SysTick ISR while SysTick is enabled */
+STATIC void Test_PatternElapse(uint32 Cycles)
+{
+	uint32 Period = Mmio_SimPeek32(SYSTICK_RELOAD_ADDRESS) + 1U;
+
+	Test_PatternCycles += Cycles;
+	while ((Test_PatternCycles >= Period) && (0U != (Mmio_SimPeek32(SYSTICK_CTRL_ADDRESS) & DIO_PATTERN_SYSTICK_ENABLE)))
+	{
+		Test_PatternCycles -= Period;
+		SysTick_Handler();
+		if (Test_PatternTicks < TEST_PATTERN_MAX_TICKS)
+		{
+			Test_PatternOutput[Test_PatternTicks++] = (uint8)Mmio_SimPeek32(GPIO_PORTF_BASE_ADDRESS + PORT_DATA_REG_OFFSET);
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+}
+
+void Test_Pattern(void)
+{
+	static const Dio_PortLevelType First[3] = {0x02U, 0x04U, 0x08U};
+	static const Dio_PortLevelType Second[2] = {0x0EU, 0xF0U};
+	static const Dio_PortLevelType Third[1] = {0x0AU};
+	static const uint8 Expected[7] = {0x83U, 0x85U, 0x89U, 0x8FU, 0x81U, 0x8BU, 0x8BU};
+	Mmio_SimCountersType Counters;
+	uint8 Index;
+
+	Test_InitDrivers();
+
+	/* Invalid port and tick periods SysTick can not generate are reported without any access */
+	Dio_PatternStart(DIO_CONFIGURED_PORTS, TEST_PATTERN_MASK, TEST_PATTERN_TICK_PERIOD);
+	TEST_CHECK(DIO_E_PARAM_INVALID_PORT_ID == Test_DetErrors.ErrorId);
+	Dio_PatternStart(DioConf_PORTF_PORT_ID_INDEX, TEST_PATTERN_MASK, 0U);
+	TEST_CHECK(DIO_E_PARAM_TICK_PERIOD == Test_DetErrors.ErrorId);
+	Dio_PatternStart(DioConf_PORTF_PORT_ID_INDEX, TEST_PATTERN_MASK, DIO_PATTERN_MAX_TICK_PERIOD + 1U);
+	TEST_CHECK(DIO_E_PARAM_TICK_PERIOD == Test_DetErrors.ErrorId);
+	TEST_CHECK(3U == Test_DetErrors.Count);
+	TEST_CHECK(DIO_PATTERN_IDLE == Dio_PatternGetState());
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK((0U == Counters.Reads) && (0U == Counters.Writes));
+
+	/* The longest period fills the 24-bit reload value */
+	Dio_PatternStart(DioConf_PORTF_PORT_ID_INDEX, TEST_PATTERN_MASK, DIO_PATTERN_MAX_TICK_PERIOD);
+	TEST_CHECK(0x00FFFFFFU == Mmio_SimPeek32(SYSTICK_RELOAD_ADDRESS));
+	Dio_PatternStop();
+
+	/* A NULL buffer and an empty buffer are reported separately */
+	Test_DetReset();
+	TEST_CHECK(E_NOT_OK == Dio_PatternQueue(NULL_PTR, 1U));
+	TEST_CHECK(DIO_E_PARAM_POINTER == Test_DetErrors.ErrorId);
+	TEST_CHECK(E_NOT_OK == Dio_PatternQueue(First, 0U));
+	TEST_CHECK(DIO_E_PARAM_LENGTH == Test_DetErrors.ErrorId);
+	Test_DetReset();
+
+	/* Every PORTF pin is an output so GPIODATA reads back the latch, PF7 and PF0 are outside
+	 * the mask and keep their values during the whole pattern */
+	MMIO_WRITE32(GPIO_PORTF_BASE_ADDRESS + PORT_DIR_REG_OFFSET, PORT_ALL_PINS_MASK);
+	MMIO_WRITE32(GPIO_PORTF_BASE_ADDRESS + PORT_DATA_REG_OFFSET, 0x81U);
+	Test_PatternCycles = 0U;
+	Test_PatternTicks  = 0U;
+	Dio_PatternStart(DioConf_PORTF_PORT_ID_INDEX, TEST_PATTERN_MASK, TEST_PATTERN_TICK_PERIOD);
+	TEST_CHECK((TEST_PATTERN_TICK_PERIOD - 1U) == Mmio_SimPeek32(SYSTICK_RELOAD_ADDRESS));
+	TEST_CHECK(DIO_PATTERN_PLAYING == Dio_PatternGetState());
+
+	/* Both buffers can be queued, a third one waits for the first to be played */
+	TEST_CHECK(E_OK == Dio_PatternQueue(First, 3U));
+	TEST_CHECK(E_OK == Dio_PatternQueue(Second, 2U));
+	TEST_CHECK(E_NOT_OK == Dio_PatternQueue(Third, 1U));
+
+	/* Less than a period does not tick */
+	Test_PatternElapse(TEST_PATTERN_TICK_PERIOD - 1U);
+	TEST_CHECK(0U == Test_PatternTicks);
+
+	/* Once the first buffer is played it is handed back and the second one is played */
+	Test_PatternElapse(1U + (2U * TEST_PATTERN_TICK_PERIOD));
+	TEST_CHECK(3U == Test_PatternTicks);
+	TEST_CHECK(E_OK == Dio_PatternQueue(Third, 1U));
+	TEST_CHECK(E_NOT_OK == Dio_PatternQueue(First, 3U));
+
+	/* Second then third buffer, then one underrun where the port keeps its last value */
+	Test_PatternElapse(4U * TEST_PATTERN_TICK_PERIOD);
+	TEST_CHECK(7U == Test_PatternTicks);
+	for (Index = 0U; Index < 7U; Index++)
+	{
+		TEST_CHECK(Expected[Index] == Test_PatternOutput[Index]);
+	}
+	TEST_CHECK(1U == Dio_PatternGetUnderruns());
+
+	/* Stop disables SysTick, the clock does not tick any more */
+	Dio_PatternStop();
+	TEST_CHECK(DIO_PATTERN_IDLE == Dio_PatternGetState());
+	Test_PatternElapse(4U * TEST_PATTERN_TICK_PERIOD);
+	TEST_CHECK(7U == Test_PatternTicks);
+
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK(0U == Counters.Faults);
+	TEST_CHECK(0U == Test_DetErrors.Count);
+}
@@ -0,0 +1,92 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_PinBatch.c
+ *
+ * Description: Checks the registers written by the batched Port_SetPinDirections and
+ *              Port_SetPinModes: the last entry of a repeated pin wins, a rejected pin
+ *              stops the whole batch and the JTAG pins are never written.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Mmio.h"
+#include "Port.h"
+#include "Port_Regs.h"
+
+/* Register of PORTA or PORTC at OFFSET */
+#define TEST_PIN_BATCH_PORTA(OFFSET)    (GPIO_PORTA_BASE_ADDRESS + (OFFSET))
+#define TEST_PIN_BATCH_PORTC(OFFSET)    (GPIO_PORTC_BASE_ADDRESS + (OFFSET))
+
+/* UART0 pin-mux set with the JTAG pin PC0 made direction and mode changeable */
+STATIC Port_ConfigType Test_PinBatchJtagConfiguration;
+
+void Test_PinBatch(void)
+{
+	static const Port_PinType Pins[3] = {PORTA_PA0, PORTA_PA1, PORTA_PA0};
+	static const Port_PinModeType Modes[3] = {PORT_ALTERNATE_FUNCTION_SSI_MODE, PORT_ALTERNATE_FUNCTION_ADC_MODE, PORT_ALTERNATE_FUNCTION_UART_MODE};
+	static const Port_PinDirectionType Directions[3] = {PORT_PIN_OUT, PORT_PIN_OUT, PORT_PIN_IN};
+	static const Port_PinType LockedPins[2] = {PORTA_PA0, PORTA_PA2};
+	static const Port_PinModeType LockedModes[2] = {PORT_DIO_MODE, PORT_ALTERNATE_FUNCTION_SSI_MODE};
+	static const Port_PinType JtagPins[2] = {PORTC_PC0, PORTA_PA1};
+	static const Port_PinModeType JtagModes[2] = {PORT_ALTERNATE_FUNCTION_UART_MODE, PORT_DIO_MODE};
+	Mmio_SimCountersType Counters;
+	uint32 JtagCtl;
+	uint32 JtagAltFunc;
+	uint32 JtagDir;
+
+	/* PA0/PA1 are direction and mode changeable in the UART0 pin-mux set only */
+	Test_InitDrivers();
+	TEST_CHECK(E_OK == Port_SwitchPinMuxSet(PortConf_UART0_PIN_MUX_SET_ID));
+
+	/* A mixed batch, PA0 is given SSI then UART: the UART entry wins */
+	Port_SetPinModes(Pins, Modes, 3U);
+	TEST_CHECK(0x03U == Mmio_SimPeek32(TEST_PIN_BATCH_PORTA(PORT_ALT_FUNC_REG_OFFSET)));
+	TEST_CHECK(0x02U == Mmio_SimPeek32(TEST_PIN_BATCH_PORTA(PORT_ANALOG_MODE_SEL_REG_OFFSET)));
+	TEST_CHECK(0xFDU == Mmio_SimPeek32(TEST_PIN_BATCH_PORTA(PORT_DIGITAL_ENABLE_REG_OFFSET)));
+	TEST_CHECK(0x00000001U == Mmio_SimPeek32(TEST_PIN_BATCH_PORTA(PORT_CTL_REG_OFFSET)));
+
+	/* PA0 is given OUT then IN: the IN entry wins */
+	Port_SetPinDirections(Pins, Directions, 3U);
+	TEST_CHECK(0x02U == (Mmio_SimPeek32(TEST_PIN_BATCH_PORTA(PORT_DIR_REG_OFFSET)) & 0x03U));
+	TEST_CHECK(0U == Test_DetErrors.Count);
+
+	/* PA2 mode and direction are locked: the whole batch is rejected and nothing is accessed */
+	Mmio_SimResetCounters();
+	Port_SetPinModes(LockedPins, LockedModes, 2U);
+	TEST_CHECK((1U == Test_DetErrors.Count) && (PORT_E_MODE_UNCHANGEABLE == Test_DetErrors.ErrorId));
+	Test_DetReset();
+	Port_SetPinDirections(LockedPins, Directions, 2U);
+	TEST_CHECK((1U == Test_DetErrors.Count) && (PORT_E_DIRECTION_UNCHANGEABLE == Test_DetErrors.ErrorId));
+	Test_DetReset();
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK((0U == Counters.Reads) && (0U == Counters.Writes));
+	TEST_CHECK(0x03U == Mmio_SimPeek32(TEST_PIN_BATCH_PORTA(PORT_ALT_FUNC_REG_OFFSET)));
+
+	/* Even when the configuration lets PC0 change, the JTAG pin is skipped and only PA1 is written */
+	Test_PinBatchJtagConfiguration = Port_Uart0Configuration;
+	Test_PinBatchJtagConfiguration.Pins[PORTC_PC0].Pin_direction_change = Pin_direction_changeable_ON;
+	Test_PinBatchJtagConfiguration.Pins[PORTC_PC0].Pin_modeChange = Pin_mode_changeable_ON;
+	Mmio_SimReset();
+	Port_Init(&Test_PinBatchJtagConfiguration);
+	JtagCtl = Mmio_SimPeek32(TEST_PIN_BATCH_PORTC(PORT_CTL_REG_OFFSET));
+	JtagAltFunc = Mmio_SimPeek32(TEST_PIN_BATCH_PORTC(PORT_ALT_FUNC_REG_OFFSET));
+	JtagDir = Mmio_SimPeek32(TEST_PIN_BATCH_PORTC(PORT_DIR_REG_OFFSET));
+	Mmio_SimResetCounters();
+	Port_SetPinModes(JtagPins, JtagModes, 2U);
+	Port_SetPinDirections(JtagPins, Directions, 2U);
+	TEST_CHECK(0U == Test_DetErrors.Count);
+	TEST_CHECK(JtagCtl == Mmio_SimPeek32(TEST_PIN_BATCH_PORTC(PORT_CTL_REG_OFFSET)));
+	TEST_CHECK(JtagAltFunc == Mmio_SimPeek32(TEST_PIN_BATCH_PORTC(PORT_ALT_FUNC_REG_OFFSET)));
+	TEST_CHECK(JtagDir == Mmio_SimPeek32(TEST_PIN_BATCH_PORTC(PORT_DIR_REG_OFFSET)));
+	TEST_CHECK(0x01U == Mmio_SimPeek32(TEST_PIN_BATCH_PORTA(PORT_ALT_FUNC_REG_OFFSET)));
+	TEST_CHECK(0x02U == (Mmio_SimPeek32(TEST_PIN_BATCH_PORTA(PORT_DIR_REG_OFFSET)) & 0x02U));
+	/* Four registers for the modes and GPIODIR for the directions, all in PORTA */
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK(5U == Counters.Writes);
+	TEST_CHECK(0U == Counters.Faults);
+
+	Test_InitDrivers();
+}
@@ -0,0 +1,65 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_PinMux.c
+ *
+ * Description: Switches between the pin-mux sets of Port_PBcfg.c and checks the
+ *              GPIOPCTL fields written from the build time differences and the
+ *              changeable pins of the pin database.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Mmio.h"
+#include "Port.h"
+#include "Port_Regs.h"
+
+/* GPIOPCTL of PORTA, where the pins of the UART0 and SSI0 pin-mux sets are */
+#define TEST_PINMUX_PORTA_CTL_ADDRESS    (GPIO_PORTA_BASE_ADDRESS + PORT_CTL_REG_OFFSET)
+
+/* GPIOPCTL of PORTA in the UART0 set (PA0/PA1 PMC 1) and in the SSI0 set (PA2-PA5 PMC 2) */
+#define TEST_PINMUX_UART0_CTL            (0x00000011U)
+#define TEST_PINMUX_SSI0_CTL             (0x00222200U)
+
+void Test_PinMux(void)
+{
+	Mmio_SimCountersType Counters;
+
+	Test_InitDrivers();
+
+	/* An unknown set is reported, switching to the active set does not access the registers */
+	TEST_CHECK(E_NOT_OK == Port_SwitchPinMuxSet(PORT_NUMBER_OF_PIN_MUX_SETS));
+	TEST_CHECK((1U == Test_DetErrors.Count) && (PORT_E_PARAM_PIN_MUX_SET == Test_DetErrors.ErrorId));
+	Test_DetReset();
+	Mmio_SimResetCounters();
+	TEST_CHECK(E_OK == Port_SwitchPinMuxSet(PortConf_DEFAULT_PIN_MUX_SET_ID));
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK((0U == Counters.Reads) && (0U == Counters.Writes));
+
+	/* PA0 mode is changeable in the UART0 pin-mux set only */
+	Port_SetPinMode(PORTA_PA0, PORT_ALTERNATE_FUNCTION_UART_MODE);
+	TEST_CHECK((1U == Test_DetErrors.Count) && (PORT_E_MODE_UNCHANGEABLE == Test_DetErrors.ErrorId));
+	Test_DetReset();
+
+	TEST_CHECK(E_OK == Port_SwitchPinMuxSet(PortConf_UART0_PIN_MUX_SET_ID));
+	TEST_CHECK(TEST_PINMUX_UART0_CTL == Mmio_SimPeek32(TEST_PINMUX_PORTA_CTL_ADDRESS));
+
+	/* A PMC field changed at runtime is written whole by the next switch, not mixed with the target */
+	Port_SetPinMode(PORTA_PA0, PORT_ALTERNATE_FUNCTION_WDT_MODE);
+	TEST_CHECK(E_OK == Port_SwitchPinMuxSet(PortConf_SSI0_PIN_MUX_SET_ID));
+	TEST_CHECK(TEST_PINMUX_SSI0_CTL == Mmio_SimPeek32(TEST_PINMUX_PORTA_CTL_ADDRESS));
+
+	/* The pin database follows the switch: PA1 direction is not changeable any more */
+	Port_SetPinDirection(PORTA_PA1, PORT_PIN_OUT);
+	TEST_CHECK((1U == Test_DetErrors.Count) && (PORT_E_DIRECTION_UNCHANGEABLE == Test_DetErrors.ErrorId));
+	Test_DetReset();
+
+	TEST_CHECK(E_OK == Port_SwitchPinMuxSet(PortConf_DEFAULT_PIN_MUX_SET_ID));
+	TEST_CHECK(0U == Mmio_SimPeek32(TEST_PINMUX_PORTA_CTL_ADDRESS));
+
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK(0U == Counters.Faults);
+	TEST_CHECK(0U == Test_DetErrors.Count);
+}
@@ -0,0 +1,113 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_Profile.c
+ *
+ * Description: Checks the count, min, max and mean returned by Dio_GetProfile and
+ *              Port_GetProfile against the bus cycles counted by the simulated register
+ *              file, whose DWT_CYCCNT is the profiling cycle counter of the host build.
+ *              It only checks something when the drivers are built with profiling on.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Mmio.h"
+#include "Port.h"
+#include "Dio.h"
+
+/* Run CALL from cleared counters and put its bus cycles in CYCLES */
+#define TEST_PROFILE_RUN(CYCLES, CALL) \
+	do \
+	{ \
+		Mmio_SimResetCounters(); \
+		CALL; \
+		Mmio_SimGetCounters(&Counters); \
+		(CYCLES) = Counters.BusCycles; \
+	} while (0)
+
+/* Number of calls measured for each service */
+#define TEST_PROFILE_CALLS    (3U)
+
+#if ((DIO_PROFILING_API == STD_ON) && (PORT_PROFILING_API == STD_ON))
+/* Check Result against the bus cycles of the TEST_PROFILE_CALLS calls measured by the test */
+STATIC void Test_ProfileCheck(const Profiling_ResultType * Result, const uint32 * Cycles)
+{
+	uint32 Min = Cycles[0];
+	uint32 Max = Cycles[0];
+	uint32 Total = 0U;
+	uint8 Index;
+
+	for (Index = 0U; Index < TEST_PROFILE_CALLS; Index++)
+	{
+		Min = (Cycles[Index] < Min) ? Cycles[Index] : Min;
+		Max = (Cycles[Index] > Max) ? Cycles[Index] : Max;
+		Total += Cycles[Index];
+	}
+	TEST_CHECK(TEST_PROFILE_CALLS == Result->Count);
+	TEST_CHECK(Min == Result->Min);
+	TEST_CHECK(Max == Result->Max);
+	TEST_CHECK((Total / TEST_PROFILE_CALLS) == Result->Mean);
+	/* The calls do not all cost the same, so min, max and mean are told apart */
+	TEST_CHECK(Min < Max);
+}
+#endif
+
+void Test_Profile(void)
+{
+#if ((DIO_PROFILING_API == STD_ON) && (PORT_PROFILING_API == STD_ON))
+	Mmio_SimCountersType Counters;
+	Profiling_ResultType Result;
+	uint32 Cycles[TEST_PROFILE_CALLS];
+
+	/* Runs first, so the services below have never been measured before */
+	Mmio_SimReset();
+	Test_DetReset();
+	TEST_PROFILE_RUN(Cycles[0], Port_Init(&Port_Configuration));
+	TEST_CHECK(E_OK == Port_GetProfile(Port_Init_SID, &Result));
+	TEST_CHECK((1U == Result.Count) && (0U != Cycles[0]));
+	TEST_CHECK((Cycles[0] == Result.Min) && (Cycles[0] == Result.Max) && (Cycles[0] == Result.Mean));
+	Dio_Init(&Dio_Configuration);
+
+	/* A service never called, a service ID out of the table and a NULL result */
+	TEST_CHECK(E_NOT_OK == Dio_GetProfile(DIO_WRITE_CHANNEL_SID, &Result));
+	TEST_CHECK(E_NOT_OK == Dio_GetProfile(DIO_PROFILING_SIDS, &Result));
+	TEST_CHECK(E_NOT_OK == Port_GetProfile(PORT_PROFILING_SIDS, &Result));
+	TEST_CHECK(E_NOT_OK == Dio_GetProfile(DIO_WRITE_CHANNEL_SID, NULL_PTR));
+	TEST_CHECK(DIO_E_PARAM_POINTER == Test_DetErrors.ErrorId);
+	TEST_CHECK(E_NOT_OK == Port_GetProfile(Port_Init_SID, NULL_PTR));
+	TEST_CHECK(PORT_E_PARAM_POINTER == Test_DetErrors.ErrorId);
+	Test_DetReset();
+
+	/* An invalid level is ignored without any access */
+	TEST_PROFILE_RUN(Cycles[0], Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH));
+	TEST_PROFILE_RUN(Cycles[1], Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, 2U));
+	TEST_PROFILE_RUN(Cycles[2], Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_LOW));
+	TEST_CHECK(E_OK == Dio_GetProfile(DIO_WRITE_CHANNEL_SID, &Result));
+	Test_ProfileCheck(&Result, Cycles);
+
+	/* Switching to the active pin-mux set writes nothing */
+	TEST_PROFILE_RUN(Cycles[0], (void)Port_SwitchPinMuxSet(PortConf_UART0_PIN_MUX_SET_ID));
+	TEST_PROFILE_RUN(Cycles[1], (void)Port_SwitchPinMuxSet(PortConf_UART0_PIN_MUX_SET_ID));
+	TEST_PROFILE_RUN(Cycles[2], (void)Port_SwitchPinMuxSet(PortConf_SSI0_PIN_MUX_SET_ID));
+	TEST_CHECK(E_OK == Port_GetProfile(Port_Switch_Pin_Mux_Set_SID, &Result));
+	Test_ProfileCheck(&Result, Cycles);
+	(void)Port_SwitchPinMuxSet(PortConf_DEFAULT_PIN_MUX_SET_ID);
+
+	/* The services added to the Dio driver are profiled too */
+	TEST_PROFILE_RUN(Cycles[0], Dio_DebounceMainFunction());
+	TEST_PROFILE_RUN(Cycles[1], (void)Dio_ReadDebouncedChannel(DIO_CONFIGURED_CHANNLES));
+	TEST_PROFILE_RUN(Cycles[2], Dio_DebounceMainFunction());
+	TEST_CHECK(E_OK == Dio_GetProfile(DIO_DEBOUNCE_MAIN_FUNCTION_SID, &Result));
+	TEST_CHECK((2U == Result.Count) && (Cycles[0] == Result.Max) && (Cycles[2] == Result.Min));
+	TEST_CHECK(E_OK == Dio_GetProfile(DIO_READ_DEBOUNCED_CHANNEL_SID, &Result));
+	TEST_CHECK((1U == Result.Count) && (0U == Result.Max));
+	TEST_CHECK(DIO_E_PARAM_INVALID_CHANNEL_ID == Test_DetErrors.ErrorId);
+	Test_DetReset();
+
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK(0U == Counters.Faults);
+	TEST_CHECK(0U == Test_DetErrors.Count);
+#endif
+}
@@ -0,0 +1,77 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_ReadCache.c
+ *
+ * Description: Checks the one pass snapshot of Dio_ReadAllPorts and, when the drivers
+ *              are built with DIO_READ_CACHE on, that Dio_ReadChannel returns the
+ *              snapshot of the last Dio_RefreshReadCache without accessing the ports.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Mmio.h"
+#include "Port.h"
+#include "Port_Regs.h"
+#include "Dio.h"
+
+/* PF1 (LED1) and PF4 (SW1) bits in the PORTF pads */
+#define TEST_READ_CACHE_LED1_PIN    (0x02U)
+#define TEST_READ_CACHE_SW1_PIN     (0x10U)
+
+void Test_ReadCache(void)
+{
+	Dio_PortsSnapshotType Snapshot;
+	Mmio_SimCountersType Counters;
+	uint8 PortNum;
+
+	Test_InitDrivers();
+	Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH);
+	Mmio_SimSetPins(PORT_F, TEST_READ_CACHE_SW1_PIN);
+	Mmio_SimSetPins(PORT_A, 0xFFU);
+
+	/* Only PORTF is used by the configuration: it is read once, the other ports read as zeros
+	 * without being accessed, so they do not fault once their clock is gated */
+	MMIO_WRITE32(SYSCTL_RCGCGPIO_ADDRESS, (1U << PORT_F));
+	Mmio_SimResetCounters();
+	Dio_ReadAllPorts(&Snapshot);
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK((1U == Counters.Reads) && (0U == Counters.Writes) && (0U == Counters.Faults));
+	TEST_CHECK(Mmio_SimGetPins(PORT_F) == Snapshot.Levels[PORT_F]);
+	TEST_CHECK((TEST_READ_CACHE_LED1_PIN | TEST_READ_CACHE_SW1_PIN) ==
+	           (Snapshot.Levels[PORT_F] & (TEST_READ_CACHE_LED1_PIN | TEST_READ_CACHE_SW1_PIN)));
+	for (PortNum = 0U; PortNum < PORT_F; PortNum++)
+	{
+		TEST_CHECK(0U == Snapshot.Levels[PortNum]);
+	}
+
+	/* A NULL snapshot is reported */
+	Dio_ReadAllPorts(NULL_PTR);
+	TEST_CHECK((1U == Test_DetErrors.Count) && (DIO_E_PARAM_POINTER == Test_DetErrors.ErrorId));
+	Test_DetReset();
+
+#if (DIO_READ_CACHE == STD_ON)
+	/* Between two refreshes Dio_ReadChannel returns the snapshot, whatever the pads do */
+	Dio_RefreshReadCache();
+	Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_LOW);
+	Mmio_SimSetPins(PORT_F, 0x00U);
+	Mmio_SimResetCounters();
+	TEST_CHECK(STD_HIGH == Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX));
+	TEST_CHECK(STD_HIGH == Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX));
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK((0U == Counters.Reads) && (0U == Counters.Writes));
+
+	/* The next refresh takes the new levels with one read of PORTF */
+	Dio_RefreshReadCache();
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK((1U == Counters.Reads) && (0U == Counters.Writes));
+	TEST_CHECK(STD_LOW == Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX));
+	TEST_CHECK(STD_LOW == Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX));
+#endif
+
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK(0U == Counters.Faults);
+	TEST_CHECK(0U == Test_DetErrors.Count);
+}
@@ -0,0 +1,100 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_Sim.c
+ *
+ * Description: Checks Port_Init and the basic Dio channel services against the
+ *              simulated register file.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Mmio.h"
+#include "Port.h"
+#include "Port_Regs.h"
+#include "Dio.h"
+
+void Test_Sim(void)
+{
+	Mmio_SimCountersType Counters;
+	uint32 Direction;
+
+	/* Port_Init and Dio_Init only access clocked ports through the configured aperture */
+	Mmio_SimReset();
+	Test_DetReset();
+	Port_Init(&Port_Configuration);
+	Dio_Init(&Dio_Configuration);
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK(0U == Counters.Faults);
+	TEST_CHECK(0U == Test_DetErrors.Count);
+
+	/* PF1 (LED1) is an output and PF4 (SW1) an input, both digital */
+	TEST_CHECK(0x02U == (Mmio_SimPeek32(GPIO_PORTF_BASE_ADDRESS + PORT_DIR_REG_OFFSET) & 0x12U));
+	TEST_CHECK(0x12U == (Mmio_SimPeek32(GPIO_PORTF_BASE_ADDRESS + PORT_DIGITAL_ENABLE_REG_OFFSET) & 0x12U));
+
+	/* A NULL configuration is reported before any access */
+	Mmio_SimReset();
+	Test_DetReset();
+	Port_Init(NULL_PTR);
+	TEST_CHECK((1U == Test_DetErrors.Count) && (PORT_E_PARAM_CONFIG == Test_DetErrors.ErrorId));
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK((0U == Counters.Reads) && (0U == Counters.Writes));
+
+	/* A port which never reports ready is not written, Port_Init returns and Port stays uninitialized */
+	Mmio_SimReset();
+	Test_DetReset();
+	Mmio_SimStallClocks(1U << PORT_F);
+	Port_Init(&Port_Configuration);
+	TEST_CHECK((1U == Test_DetErrors.Count) && (PORT_E_CLOCK_NOT_READY == Test_DetErrors.ErrorId));
+	TEST_CHECK(0U == Mmio_SimPeek32(GPIO_PORTF_BASE_ADDRESS + PORT_DIGITAL_ENABLE_REG_OFFSET));
+	Port_RefreshPortDirection();
+	TEST_CHECK((2U == Test_DetErrors.Count) && (PORT_E_UNINIT == Test_DetErrors.ErrorId));
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK(0U == Counters.Faults);
+
+	/* Port_RefreshPortDirection restores the PORTF directions, the PORTC JTAG pins keep theirs */
+	Test_InitDrivers();
+	Direction = Mmio_SimPeek32(GPIO_PORTF_BASE_ADDRESS + PORT_DIR_REG_OFFSET);
+	MMIO_WRITE32(GPIO_PORTF_BASE_ADDRESS + PORT_DIR_REG_OFFSET, ~Direction & PORT_F_PINS_MASK);
+	MMIO_WRITE32(GPIO_PORTC_BASE_ADDRESS + PORT_DIR_REG_OFFSET, 0x0FU);
+	Port_RefreshPortDirection();
+	TEST_CHECK(Direction == Mmio_SimPeek32(GPIO_PORTF_BASE_ADDRESS + PORT_DIR_REG_OFFSET));
+	TEST_CHECK(0x0FU == (Mmio_SimPeek32(GPIO_PORTC_BASE_ADDRESS + PORT_DIR_REG_OFFSET) & 0x0FU));
+
+	/* Writing LED1 drives the PF1 pad. With the read cache Dio_ReadChannel returns the last
+	 * snapshot instead of the pad, Test_ReadCache.c checks it */
+	Test_InitDrivers();
+	Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH);
+	TEST_CHECK(0x02U == (Mmio_SimGetPins(PORT_F) & 0x02U));
+#if (DIO_READ_CACHE == STD_OFF)
+	TEST_CHECK(STD_HIGH == Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX));
+#endif
+	Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_LOW);
+	TEST_CHECK(0x00U == (Mmio_SimGetPins(PORT_F) & 0x02U));
+#if (DIO_READ_CACHE == STD_OFF)
+	TEST_CHECK(STD_LOW == Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX));
+#endif
+
+	/* Writing an input channel does not change its pad, reading it follows the external level */
+	Mmio_SimSetPins(PORT_F, 0x10U);
+	Dio_WriteChannel(DioConf_SW1_CHANNEL_ID_INDEX, STD_LOW);
+	TEST_CHECK(0x10U == (Mmio_SimGetPins(PORT_F) & 0x10U));
+#if (DIO_READ_CACHE == STD_OFF)
+	TEST_CHECK(STD_HIGH == Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX));
+	Mmio_SimSetPins(PORT_F, 0x00U);
+	TEST_CHECK(STD_LOW == Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX));
+#endif
+
+	/* An invalid channel is reported and does not access the hardware */
+	Mmio_SimResetCounters();
+	Dio_WriteChannel(DIO_CONFIGURED_CHANNLES, STD_HIGH);
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK(1U == Test_DetErrors.Count);
+	TEST_CHECK(DIO_E_PARAM_INVALID_CHANNEL_ID == Test_DetErrors.ErrorId);
+	TEST_CHECK((0U == Counters.Reads) && (0U == Counters.Writes));
+
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK(0U == Counters.Faults);
+}
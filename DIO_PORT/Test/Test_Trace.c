@@ -0,0 +1,115 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_Trace.c
+ *
+ * Description: Overflows the write trace ring of Dio.c and checks that Dio_TraceDump
+ *              returns the newest records, oldest first, with their Sid, Id and Value.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Mmio.h"
+#include "Port.h"
+#include "Dio.h"
+
+#if (DIO_TRACE_API == STD_ON)
+
+/* Number of traced writes, more than the ring holds so the oldest ones are overwritten */
+#define TEST_TRACE_WRITES          (DIO_TRACE_RING_SIZE + 6U)
+
+/* Write number Index: even ones write PORTF with Index, odd ones write LED1 or SW1 */
+STATIC void Test_TraceWrite(uint32 Index)
+{
+	if (0U == (Index & 1U))
+	{
+		Dio_WritePort(DioConf_PORTF_PORT_ID_INDEX, (Dio_PortLevelType)Index);
+	}
+	else
+	{
+		Dio_WriteChannel((0U == (Index & 2U)) ? DioConf_LED1_CHANNEL_ID_INDEX : DioConf_SW1_CHANNEL_ID_INDEX,
+		                 (0U == (Index & 4U)) ? STD_LOW : STD_HIGH);
+	}
+}
+
+/* Check that Record is the one taken by write number Index */
+STATIC void Test_TraceCheck(const Dio_TraceRecordType * Record, uint32 Index)
+{
+	if (0U == (Index & 1U))
+	{
+		TEST_CHECK(DIO_WRITE_PORT_SID == Record->Sid);
+		TEST_CHECK(DioConf_PORTF_PORT_ID_INDEX == Record->Id);
+		TEST_CHECK((uint8)Index == Record->Value);
+	}
+	else
+	{
+		TEST_CHECK(DIO_WRITE_CHANNEL_SID == Record->Sid);
+		TEST_CHECK(((0U == (Index & 2U)) ? DioConf_LED1_CHANNEL_ID_INDEX : DioConf_SW1_CHANNEL_ID_INDEX) == Record->Id);
+		TEST_CHECK(((0U == (Index & 4U)) ? STD_LOW : STD_HIGH) == Record->Value);
+	}
+}
+
+void Test_Trace(void)
+{
+	Dio_TraceRecordType Records[DIO_TRACE_RING_SIZE + 2U];
+	uint32 Index;
+	uint32 Copied;
+
+	/* Dio_Init empties the ring */
+	Test_InitDrivers();
+	TEST_CHECK(0U == Dio_TraceDump(Records, DIO_TRACE_RING_SIZE));
+
+	/* Before the ring wraps every record is returned, an invalid level is not traced */
+	Test_TraceWrite(0U);
+	Test_TraceWrite(1U);
+	Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, 2U);
+	TEST_CHECK(2U == Dio_TraceDump(Records, DIO_TRACE_RING_SIZE));
+	Test_TraceCheck(&Records[0], 0U);
+	Test_TraceCheck(&Records[1], 1U);
+
+	for (Index = 2U; Index < TEST_TRACE_WRITES; Index++)
+	{
+		Test_TraceWrite(Index);
+	}
+
+	/* A larger buffer gets the DIO_TRACE_RING_SIZE newest records, oldest first */
+	Copied = Dio_TraceDump(Records, DIO_TRACE_RING_SIZE + 2U);
+	TEST_CHECK(DIO_TRACE_RING_SIZE == Copied);
+	for (Index = 0U; Index < DIO_TRACE_RING_SIZE; Index++)
+	{
+		Test_TraceCheck(&Records[Index], TEST_TRACE_WRITES - DIO_TRACE_RING_SIZE + Index);
+		/* Every traced write is a bus access, so the simulated cycle counter advances between records */
+		if (0U != Index)
+		{
+			TEST_CHECK(Records[Index].Cycles > Records[Index - 1U].Cycles);
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+
+	/* A smaller buffer gets the newest records only */
+	TEST_CHECK(3U == Dio_TraceDump(Records, 3U));
+	for (Index = 0U; Index < 3U; Index++)
+	{
+		Test_TraceCheck(&Records[Index], TEST_TRACE_WRITES - 3U + Index);
+	}
+
+	/* A NULL buffer is reported and copies nothing */
+	TEST_CHECK(0U == Test_DetErrors.Count);
+	TEST_CHECK(0U == Dio_TraceDump(NULL_PTR, DIO_TRACE_RING_SIZE));
+	TEST_CHECK((1U == Test_DetErrors.Count) && (DIO_E_PARAM_POINTER == Test_DetErrors.ErrorId));
+	Test_DetReset();
+}
+
+#else
+
+void Test_Trace(void)
+{
+	/* The trace ring is only built in the profiling variant */
+}
+
+#endif
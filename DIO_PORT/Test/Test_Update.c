@@ -0,0 +1,85 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_Update.c
+ *
+ * Description: Checks the staged update transaction: staging only touches the shadow
+ *              image, the normal write services keep writing the hardware inside a
+ *              transaction, transactions do not nest and Dio_Init drops an open one.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Mmio.h"
+#include "Port.h"
+#include "Dio.h"
+
+/* PF1 (LED1) bit in the PORTF pads */
+#define TEST_UPDATE_LED1_PIN    (0x02U)
+
+void Test_Update(void)
+{
+	Mmio_SimCountersType Counters;
+
+	Test_InitDrivers();
+	Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_LOW);
+
+	/* Staging and committing outside a transaction are reported and do nothing */
+	Mmio_SimResetCounters();
+	Dio_StageChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH);
+	TEST_CHECK(DIO_E_TRANSACTION == Test_DetErrors.ErrorId);
+	(void)Dio_StageFlipChannel(DioConf_LED1_CHANNEL_ID_INDEX);
+	TEST_CHECK(DIO_E_TRANSACTION == Test_DetErrors.ErrorId);
+	Dio_Commit();
+	TEST_CHECK(DIO_E_TRANSACTION == Test_DetErrors.ErrorId);
+	TEST_CHECK(3U == Test_DetErrors.Count);
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK((0U == Counters.Reads) && (0U == Counters.Writes));
+	Test_DetReset();
+
+	/* A nested Dio_BeginUpdate is rejected, the open transaction goes on */
+	Dio_BeginUpdate();
+	Dio_BeginUpdate();
+	TEST_CHECK((1U == Test_DetErrors.Count) && (DIO_E_TRANSACTION == Test_DetErrors.ErrorId));
+	Test_DetReset();
+
+	/* Staged levels reach the pads on Dio_Commit only */
+	Dio_StageChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH);
+	TEST_CHECK(0U == (Mmio_SimGetPins(PORT_F) & TEST_UPDATE_LED1_PIN));
+	TEST_CHECK(STD_LOW == Dio_StageFlipChannel(DioConf_LED1_CHANNEL_ID_INDEX));
+	TEST_CHECK(STD_HIGH == Dio_StageFlipChannel(DioConf_LED1_CHANNEL_ID_INDEX));
+	TEST_CHECK(0U == (Mmio_SimGetPins(PORT_F) & TEST_UPDATE_LED1_PIN));
+	Dio_Commit();
+	TEST_CHECK(TEST_UPDATE_LED1_PIN == (Mmio_SimGetPins(PORT_F) & TEST_UPDATE_LED1_PIN));
+
+	/* Inside a transaction Dio_WriteChannel and Dio_FlipChannel (e.g. from an ISR) write the pads */
+	Dio_BeginUpdate();
+	Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_LOW);
+	TEST_CHECK(0U == (Mmio_SimGetPins(PORT_F) & TEST_UPDATE_LED1_PIN));
+	TEST_CHECK(STD_HIGH == Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX));
+	TEST_CHECK(TEST_UPDATE_LED1_PIN == (Mmio_SimGetPins(PORT_F) & TEST_UPDATE_LED1_PIN));
+	/* A channel not staged yet is flipped from its hardware level */
+	TEST_CHECK(STD_LOW == Dio_StageFlipChannel(DioConf_LED1_CHANNEL_ID_INDEX));
+	Dio_Commit();
+	TEST_CHECK(0U == (Mmio_SimGetPins(PORT_F) & TEST_UPDATE_LED1_PIN));
+
+	/* Dio_Init drops an open transaction and its staged channels */
+	Dio_BeginUpdate();
+	Dio_StageChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH);
+	Dio_Init(&Dio_Configuration);
+	Dio_Commit();
+	TEST_CHECK((1U == Test_DetErrors.Count) && (DIO_E_TRANSACTION == Test_DetErrors.ErrorId));
+	Test_DetReset();
+	Dio_BeginUpdate();
+	Mmio_SimResetCounters();
+	Dio_Commit();
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK(0U == Counters.Writes);
+	TEST_CHECK(0U == (Mmio_SimGetPins(PORT_F) & TEST_UPDATE_LED1_PIN));
+
+	Mmio_SimGetCounters(&Counters);
+	TEST_CHECK(0U == Counters.Faults);
+	TEST_CHECK(0U == Test_DetErrors.Count);
+}
@@ -23,6 +23,12 @@ extern void SVC_Handler( void );
 extern void DebugMon_Handler( void );
 extern void PendSV_Handler( void );
 extern void SysTick_Handler( void );
+extern void GPIOPortA_Handler( void );
+extern void GPIOPortB_Handler( void );
+extern void GPIOPortC_Handler( void );
+extern void GPIOPortD_Handler( void );
+extern void GPIOPortE_Handler( void );
+extern void GPIOPortF_Handler( void );
 
 typedef void( *intfunc )( void );
 typedef union { intfunc __fun; void * __ptr; } intvec_elem;
@@ -56,7 +62,20 @@ const intvec_elem __vector_table[] =
   DebugMon_Handler,
   0,
   PendSV_Handler,
-  SysTick_Handler
+  SysTick_Handler,
+
+  // TM4C123GH6PM external interrupts
+  GPIOPortA_Handler,          // IRQ 0
+  GPIOPortB_Handler,          // IRQ 1
+  GPIOPortC_Handler,          // IRQ 2
+  GPIOPortD_Handler,          // IRQ 3
+  GPIOPortE_Handler,          // IRQ 4
+  0, 0, 0, 0, 0,              // IRQ 5  --> 9
+  0, 0, 0, 0, 0,              // IRQ 10 --> 14
+  0, 0, 0, 0, 0,              // IRQ 15 --> 19
+  0, 0, 0, 0, 0,              // IRQ 20 --> 24
+  0, 0, 0, 0, 0,              // IRQ 25 --> 29
+  GPIOPortF_Handler           // IRQ 30
 
 };
 
@@ -78,6 +97,18 @@ __weak void DebugMon_Handler( void ) { while (1) {} }
 __weak void PendSV_Handler( void ) { while (1) {} }
 #pragma call_graph_root = "interrupt"
 __weak void SysTick_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOPortA_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOPortB_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOPortC_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOPortD_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOPortE_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOPortF_Handler( void ) { while (1) {} }
 
 
 void __cmain( void );
@@ -145,6 +145,18 @@ Systick Timer Registers
 #define SYSTICK_RELOAD_REG        (*((volatile uint32 *)0xE000E014))
 #define SYSTICK_CURRENT_REG       (*((volatile uint32 *)0xE000E018))
 
+/* Systick Timer Registers addresses, accessed through Mmio.h */
+#define SYSTICK_CTRL_ADDRESS      (0xE000E010U)
+#define SYSTICK_RELOAD_ADDRESS    (0xE000E014U)
+#define SYSTICK_CURRENT_ADDRESS   (0xE000E018U)
+
+/*****************************************************************************
+DWT Cycle Counter Registers addresses, accessed through Mmio.h
+*****************************************************************************/
+#define CORE_DEMCR_ADDRESS        (0xE000EDFCU)
+#define DWT_CTRL_ADDRESS          (0xE0001000U)
+#define DWT_CYCCNT_ADDRESS        (0xE0001004U)
+
 /*****************************************************************************
 PLL Registers
 *****************************************************************************/
@@ -202,6 +214,9 @@ NVIC Registers
 #define NVIC_DIS3_REG             (*((volatile uint32 *)0xE000E18C))
 #define NVIC_DIS4_REG             (*((volatile uint32 *)0xE000E190))
 
+/* NVIC Interrupt Set Enable register 0 address, accessed through Mmio.h */
+#define NVIC_EN0_ADDRESS          (0xE000E100U)
+
 #define NVIC_SYSTEM_PRI1_REG      (*((volatile uint32 *)0xE000ED18))
 #define NVIC_SYSTEM_PRI2_REG      (*((volatile uint32 *)0xE000ED1C))
 #define NVIC_SYSTEM_PRI3_REG      (*((volatile uint32 *)0xE000ED20))